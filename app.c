@@ -112,7 +112,7 @@ static int app_send_sms_exec (attribute_unused struct ast_channel* channel, cons
 		return -1;
 	}
 
-	if (send_sms(args.device, args.number, args.message, args.validity, args.report, args.payload, strlen(args.payload) + 1) < 0) {
+	if (send_sms(args.device, args.number, args.message, args.validity, args.report, args.payload, strlen(args.payload) + 1, NULL) < 0) {
 		ast_log(LOG_ERROR, "[%s] %s\n", args.device, error2str(chan_quectel_err));
 		return -1;
 	}
@@ -180,7 +180,8 @@ static const struct quectel_application
 		app_send_sms_exec,
 		"QuectelSendSMS(Device,Dest,Message,Validity,Report,Payload)",
 		"QuectelSendSMS(Device,Dest,Message,Validity,Report,Payload)\n"
-		"  Device   - Id of device from quectel5g.conf\n"
+		"  Device   - Id of device from quectel5g.conf, or g<N>, r<N>, p:<provider>,\n"
+		"             s:<imsi prefix>, i:<imei> to use the ready device with the shortest queue\n"
 		"  Dest     - destination\n"
 		"  Message  - text of the message\n"
 		"  Validity - Validity period in minutes\n"
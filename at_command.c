@@ -249,13 +249,14 @@ EXPORT_DEF int at_enqueue_cops(struct cpvt *cpvt)
 
 
 /* SMS sending */
-static int at_enqueue_pdu(struct cpvt *cpvt, const char *pdu, size_t length, size_t tpdulen, int uid)
+static int at_enqueue_pdu(struct cpvt *cpvt, const pdu_part_t *pdu, int uid)
 {
 	char buf[8+25+1];
 	at_queue_cmd_t at_cmd[] = {
 		{ CMD_AT_CMGS,    RES_SMS_PROMPT, ATQ_CMD_FLAG_DEFAULT, { ATQ_CMD_TIMEOUT_MEDIUM, 0}, NULL, 0 },
 		{ CMD_AT_SMSTEXT, RES_OK,         ATQ_CMD_FLAG_DEFAULT, { ATQ_CMD_TIMEOUT_LONG, 0},   NULL, 0 }
 		};
+	size_t length = pdu->length * 2;
 
 	at_cmd[1].data = ast_malloc(length + 2);
 	if(!at_cmd[1].data)
@@ -265,11 +266,12 @@ static int at_enqueue_pdu(struct cpvt *cpvt, const char *pdu, size_t length, siz
 
 	at_cmd[1].length = length + 1;
 
-	memcpy(at_cmd[1].data, pdu, length);
+	/* hexify straight into command buffer */
+	hexify(pdu->buffer, pdu->length, at_cmd[1].data);
 	at_cmd[1].data[length] = 0x1A;
 	at_cmd[1].data[length + 1] = 0x0;
 
-	at_cmd[0].length = snprintf(buf, sizeof(buf), "AT+CMGS=%d\r", (int)tpdulen);
+	at_cmd[0].length = snprintf(buf, sizeof(buf), "AT+CMGS=%d\r", (int)pdu->tpdu_length);
 	at_cmd[0].data = ast_strdup(buf);
 	if(!at_cmd[0].data)
 	{
@@ -285,54 +287,167 @@ static int at_enqueue_pdu(struct cpvt *cpvt, const char *pdu, size_t length, siz
 }
 
 /*!
- * \brief Enqueue a SMS message
- * \param cpvt -- cpvt structure
- * \param number -- the destination of the message
+ * \brief Build the PDUs of a SMS message and register it in smsdb
+ * \param imsi -- IMSI of the sending device, key for reference and outgoing tables
+ * \param group -- group of the sending device, device of the same group may resend the message
+ * \param destination -- the destination of the message
  * \param msg -- utf-8 encoded message
+ * \return allocated message ready for at_enqueue_sms_prepared(), NULL on error
  */
-EXPORT_DEF int at_enqueue_sms(struct cpvt *cpvt, const char *destination, const char *msg, unsigned validity_minutes, int report_req, const char *payload, size_t payload_len)
+EXPORT_DEF at_sms_t *at_sms_prepare(const char *imsi, int group, const char *destination, const char *msg, unsigned validity_minutes, int report_req, const char *payload, size_t payload_len)
 {
 	ssize_t res;
-	pvt_t* pvt = cpvt->pvt;
+	at_sms_t *sms;
+	pdu_iter_t iter;
+	unsigned i;
 
 	/* set default validity period */
 	if (validity_minutes <= 0)
 		validity_minutes = 3 * 24 * 60;
 
-	int msg_len = strlen(msg);
-	uint16_t msg_ucs2[msg_len * 2];
-	res = utf8_to_ucs2(msg, msg_len, msg_ucs2, sizeof(msg_ucs2));
+	/* UTF-8 never takes less bytes than UCS-2 characters */
+	size_t msg_len = strlen(msg);
+	uint16_t *msg_ucs2 = ast_malloc((msg_len + 1) * sizeof(*msg_ucs2));
+	if (!msg_ucs2) {
+		chan_quectel_err = E_UNKNOWN;
+		return NULL;
+	}
+	res = utf8_to_ucs2(msg, msg_len, msg_ucs2, msg_len + 1);
 	if (res < 0) {
+		ast_free(msg_ucs2);
 		chan_quectel_err = E_PARSE_UTF8;
-		return -1;
+		return NULL;
 	}
 
-	char hexbuf[PDU_LENGTH * 2 + 1];
-
-	pdu_part_t pdus[255];
-	int csmsref = smsdb_get_refid(pvt->imsi, destination);
+	int csmsref = smsdb_get_refid(imsi, destination);
 	if (csmsref < 0) {
+		ast_free(msg_ucs2);
 		chan_quectel_err = E_SMSDB;
-		return -1;
+		return NULL;
 	}
-	res = pdu_build_mult(pdus, "" /* pvt->sms_scenter */, destination, msg_ucs2, res, validity_minutes, !!report_req, csmsref);
+	res = pdu_iter_init(&iter, "" /* pvt->sms_scenter */, destination, msg_ucs2, res, validity_minutes, !!report_req, csmsref);
 	if (res < 0) {
-		/* pdu_build_mult sets chan_quectel_err */
-		return -1;
+		/* pdu_iter_init sets chan_quectel_err */
+		ast_free(msg_ucs2);
+		return NULL;
+	}
+
+	sms = ast_malloc(sizeof(*sms) + res * sizeof(sms->pdus[0]));
+	if (!sms) {
+		ast_free(msg_ucs2);
+		chan_quectel_err = E_UNKNOWN;
+		return NULL;
 	}
-	int uid = smsdb_outgoing_add(pvt->imsi, destination, res, validity_minutes * 60, report_req, payload, payload_len);
-	if (uid < 0) {
+	sms->entry.next = NULL;
+	sms->parts = res;
+
+	/* each part is built in place */
+	for (i = 0; i < sms->parts; ++i) {
+		if (pdu_iter_next(&iter, &sms->pdus[i]) <= 0) {
+			/* pdu_iter_next sets chan_quectel_err */
+			ast_free(msg_ucs2);
+			ast_free(sms);
+			return NULL;
+		}
+	}
+	ast_free(msg_ucs2);
+
+	/* message and its parts are stored atomically */
+	smsdb_batch_begin();
+	sms->uid = smsdb_outgoing_add(imsi, destination, res, validity_minutes * 60, report_req, payload, payload_len);
+	for (i = 0; sms->uid >= 0 && i < sms->parts; ++i) {
+		if (smsdb_outgoing_pdu_add(sms->uid, i, group, &sms->pdus[i]) < 0) {
+			char dst[SMSDB_DST_MAX_LEN];
+			char pl[SMSDB_PAYLOAD_MAX_LEN];
+			smsdb_outgoing_clear(sms->uid, dst, pl);
+			sms->uid = -1;
+		}
+	}
+	smsdb_batch_end();
+
+	if (sms->uid < 0) {
+		ast_free(sms);
 		chan_quectel_err = E_SMSDB;
-		return -1;
+		return NULL;
 	}
-	for (int i = 0; i < res; ++i) {
-		hexify(pdus[i].buffer, pdus[i].length, hexbuf);
-		if (at_enqueue_pdu(cpvt, hexbuf, pdus[i].length * 2, pdus[i].tpdu_length, uid) < 0) {
-			return -1;
+
+	return sms;
+}
+
+/*!
+ * \brief Take SMS message waiting in smsdb for (re)send
+ * \param imsi -- IMSI of device
+ * \param group -- group of device
+ * \param takeover -- seconds after which message of other device of the group is taken
+ * \return allocated message ready for at_enqueue_sms_prepared(), NULL if nothing is waiting or on error
+ */
+EXPORT_DEF at_sms_t *at_sms_resume(const char *imsi, int group, int takeover)
+{
+	at_sms_t *sms;
+	pdu_part_t *pdus;
+	unsigned parts;
+	int uid;
+
+	pdus = smsdb_outgoing_resume(imsi, group, takeover, &uid, &parts);
+	if (!pdus) {
+		return NULL;
+	}
+
+	sms = ast_malloc(sizeof(*sms) + parts * sizeof(sms->pdus[0]));
+	if (!sms) {
+		/* parts are spooled already, give them back */
+		smsdb_outgoing_pdu_unspool(uid, 0);
+	} else {
+		sms->entry.next = NULL;
+		sms->uid = uid;
+		sms->parts = parts;
+		memcpy(sms->pdus, pdus, parts * sizeof(sms->pdus[0]));
+	}
+	ast_free(pdus);
+
+	return sms;
+}
+
+/*!
+ * \brief Enqueue all PDUs of a prepared SMS message
+ * \param cpvt -- cpvt structure
+ * \param sms -- message built by at_sms_prepare(), not freed here
+ */
+EXPORT_DEF int at_enqueue_sms_prepared(struct cpvt *cpvt, const at_sms_t *sms)
+{
+	unsigned i;
+
+	for (i = 0; i < sms->parts; ++i) {
+		if (at_enqueue_pdu(cpvt, &sms->pdus[i], sms->uid) < 0) {
+			break;
 		}
 	}
 
-	return 0;
+	/* parts not queued go back to smsdb for resend, only the queued ones are sending */
+	if (i < sms->parts) {
+		smsdb_outgoing_pdu_unspool(sms->uid, i);
+	}
+	smsdb_outgoing_pdu_sending(sms->uid);
+
+	return i < sms->parts ? -1 : 0;
+}
+
+/*!
+ * \brief Enqueue a SMS message
+ * \param cpvt -- cpvt structure
+ * \param number -- the destination of the message
+ * \param msg -- utf-8 encoded message
+ */
+EXPORT_DEF int at_enqueue_sms(struct cpvt *cpvt, const char *destination, const char *msg, unsigned validity_minutes, int report_req, const char *payload, size_t payload_len)
+{
+	at_sms_t *sms = at_sms_prepare(cpvt->pvt->imsi, CONF_SHARED(cpvt->pvt, group), destination, msg, validity_minutes, report_req, payload, payload_len);
+	if (!sms) {
+		return -1;
+	}
+
+	int res = at_enqueue_sms_prepared(cpvt, sms);
+	ast_free(sms);
+	return res;
 }
 
 /*!
@@ -6,9 +6,12 @@
 
 #include "ast_config.h"
 
+#include <asterisk/linkedlists.h>	/* AST_LIST_ENTRY */
+
 #include "export.h"		/* EXPORT_DECL EXPORT_DEF */
 #include "dc_config.h"		/* call_waiting_t */
 #include "mutils.h"		/* enum2str_def() ITEMS_OF() */
+#include "pdu.h"		/* pdu_part_t */
 
 #define CCWA_CLASS_VOICE	1
 #define	SMS_INDEX_MAX		256	/* exclusive */
@@ -16,6 +19,7 @@
 /* AT_COMMANDS_TABLE */
 #define AT_CMD_AS_ENUM(cmd, str) CMD_ ## cmd,
 #define AT_CMD_AS_STRING(cmd, str) str,
+#define AT_CMD_AS_COUNT(cmd, str) + 1
 
 #define AT_COMMANDS_TABLE(_) \
 	_( USER,            "USER'S") \
@@ -86,6 +90,8 @@ typedef enum {
 	AT_COMMANDS_TABLE(AT_CMD_AS_ENUM)
 } at_cmd_t;
 
+#define AT_CMDS_NUMBER		(0 AT_COMMANDS_TABLE(AT_CMD_AS_COUNT))
+
 typedef enum {
 	SUPPRESS_ERROR_DISABLED,
 	SUPPRESS_ERROR_ENABLED
@@ -107,11 +113,24 @@ INLINE_DECL const char* at_cmd2str (at_cmd_t cmd)
 
 struct cpvt;
 
+/* SMS message with PDUs built and smsdb record allocated */
+typedef struct at_sms
+{
+	AST_LIST_ENTRY (at_sms) entry;
+
+	int		uid;			/*!< outgoing_msg rowid in smsdb */
+	unsigned	parts;			/*!< number of PDUs */
+	pdu_part_t	pdus[0];		/* this field must be last */
+} at_sms_t;
+
 EXPORT_DECL const char *at_cmd2str(at_cmd_t cmd);
 EXPORT_DECL int at_enqueue_initialization(struct cpvt *cpvt, at_cmd_t from_command);
 EXPORT_DECL int at_enqueue_ping(struct cpvt *cpvt);
 EXPORT_DECL int at_enqueue_cops(struct cpvt *cpvt);
 EXPORT_DECL int at_enqueue_sms(struct cpvt *cpvt, const char *number, const char *msg, unsigned validity_min, int report_req, const char *payload, size_t payload_len);
+EXPORT_DECL at_sms_t *at_sms_prepare(const char *imsi, int group, const char *number, const char *msg, unsigned validity_min, int report_req, const char *payload, size_t payload_len);
+EXPORT_DECL at_sms_t *at_sms_resume(const char *imsi, int group, int takeover);
+EXPORT_DECL int at_enqueue_sms_prepared(struct cpvt *cpvt, const at_sms_t *sms);
 EXPORT_DECL int at_enqueue_ussd(struct cpvt *cpvt, const char *code);
 EXPORT_DECL int at_enqueue_dtmf(struct cpvt *cpvt, char digit);
 EXPORT_DECL int at_enqueue_set_ccwa(struct cpvt *cpvt, unsigned call_waiting);
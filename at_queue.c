@@ -94,6 +94,8 @@ static at_queue_cmd_t* at_queue_head_cmd_nc (const struct pvt * pvt)
 static at_queue_task_t * at_queue_add (struct cpvt * cpvt, const at_queue_cmd_t * cmds, unsigned cmdsno, int prio)
 {
 	at_queue_task_t * e = NULL;
+	unsigned idx;
+
 	if(cmdsno > 0)
 	{
 		e = ast_malloc (sizeof(*e) + cmdsno * sizeof(*cmds));
@@ -108,6 +110,8 @@ static at_queue_task_t * at_queue_add (struct cpvt * cpvt, const at_queue_cmd_t
 			e->cpvt = cpvt;
 
 			memcpy(&e->cmds[0], cmds, cmdsno * sizeof(*cmds));
+			for(idx = 0; idx < cmdsno; idx++)
+				e->cmds[idx].written = ast_tv(0, 0);
 
 
 			if(prio && (first = AST_LIST_FIRST (&pvt->at_queue)))
@@ -118,8 +122,8 @@ static at_queue_task_t * at_queue_add (struct cpvt * cpvt, const at_queue_cmd_t
 			PVT_STATE(pvt, at_tasks) ++;
 			PVT_STATE(pvt, at_cmds) += cmdsno;
 
-			PVT_STAT(pvt, at_tasks) ++;
-			PVT_STAT(pvt, at_cmds) += cmdsno;
+			PVT_STAT_ADD(pvt, at_tasks, 1);
+			PVT_STAT_ADD(pvt, at_cmds, cmdsno);
 
 			ast_debug (4, "[%s] insert task with %u commands begin with '%s' expected response '%s' %s of queue\n",
 					PVT_ID(pvt), e->cmdsno, at_cmd2str (e->cmds[0].cmd),
@@ -191,7 +195,7 @@ EXPORT_DEF int at_write (struct pvt* pvt, const char* buf, size_t count)
 	ast_debug (5, "[%s] [%.*s]\n", PVT_ID(pvt), (int) count, buf);
 
 	wrote = write_all(pvt->data_fd, buf, count);
-	PVT_STAT(pvt, d_write_bytes) += wrote;
+	PVT_STAT_ADD(pvt, d_write_bytes, wrote);
 	if(wrote != count)
 	{
 		ast_debug (1, "[%s] write() error: %d\n", PVT_ID(pvt), errno);
@@ -213,6 +217,9 @@ EXPORT_DEF void at_queue_remove_cmd (struct pvt* pvt, at_res_t res)
 	{
 		unsigned index = task->cindex;
 
+		if(!ast_tvzero(task->cmds[index].written))
+			hist_add(&PVT_STAT(pvt, at_latency[task->cmds[index].cmd]), ast_tvdiff_us(ast_tvnow(), task->cmds[index].written));
+
 		task->cindex++;
 		PVT_STATE(pvt, at_cmds)--;
 		ast_debug (4, "[%s] remove command '%s' expected response '%s' real '%s' cmd %u/%u flags 0x%02x from queue\n",
@@ -254,7 +261,8 @@ EXPORT_DEF int at_queue_run (struct pvt * pvt)
 			else
 			{
 				/* set expire time */
-				cmd->timeout = ast_tvadd (ast_tvnow(), cmd->timeout);
+				cmd->written = ast_tvnow();
+				cmd->timeout = ast_tvadd (cmd->written, cmd->timeout);
 
 				/* free data and mark as written */
 				at_queue_free_data(cmd);
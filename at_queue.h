@@ -32,6 +32,7 @@ typedef struct at_queue_cmd
 
 	char*			data;			/*!< command and data to send in device */
 	unsigned		length;			/*!< data length */
+	struct timeval		written;		/*!< time when command written on device, zero before */
 } at_queue_cmd_t;
 
 /* initializers */
@@ -203,7 +203,7 @@ EXPORT_DEF int at_read_result_iov (struct pvt *pvt, int * read_result, struct ri
 			}
 			else if (rb_memcmp (rb, "+CMGR:", 6) == 0 || rb_memcmp (rb, "+CNUM:", 6) == 0 || rb_memcmp (rb, "ERROR+CNUM:", 11) == 0 || rb_memcmp (rb, "+CLCC:", 6) == 0)
 			{
-				iovcnt = rb_read_until_mem_iov (rb, iov, "\n\r\nOK\r\n", 7);
+				iovcnt = rb_scan_until_mem_iov (rb, iov, "\n\r\nOK\r\n", 7);
 				if (iovcnt > 0)
 				{
 					*read_result = 0;
@@ -214,8 +214,8 @@ EXPORT_DEF int at_read_result_iov (struct pvt *pvt, int * read_result, struct ri
 			else
 			{
 				ast_verb (100, "[%s] %s: General matched (rb=0x%02x,iov_len=0x%02x)\n", dev, __func__, rb, rb->size - rb->read);
-				iovcnt = rb_read_until_mem_iov (rb, iov, "\r\n", 2);
-				ast_verb (100, "[%s] %s: rb_read_until_mem_iov returned (rb=0x%02x,iov_len=0x%02x, iovcnt=%d)\n", dev, __func__, rb, rb->size - rb->read, iovcnt);
+				iovcnt = rb_scan_until_mem_iov (rb, iov, "\r\n", 2);
+				ast_verb (100, "[%s] %s: rb_scan_until_mem_iov returned (rb=0x%02x,iov_len=0x%02x, iovcnt=%d)\n", dev, __func__, rb, rb->size - rb->read, iovcnt);
 				ast_verb (100, "[%s] %s: \"%.*s\"\n", dev, __func__, iov[0].iov_len + iov[1].iov_len + 1, (char*)rb->buffer + rb->read);
 				if (iovcnt > 0)
 				{
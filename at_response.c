@@ -27,6 +27,7 @@
 #include "channel.h"				/* channel_queue_hangup() channel_queue_control() */
 #include "smsdb.h"
 #include "error.h"
+#include "pdiscovery.h"				/* pdiscovery_forget() */
 
 #define CCWA_STATUS_NOT_ACTIVE	0
 #define CCWA_STATUS_ACTIVE	1
@@ -109,7 +110,7 @@ static int at_response_rcend (struct pvt * pvt, const char* str)
                 ast_debug (1,	"[%s] CEND: call_index %d duration %d end_status %d cc_cause %d Line disconnected\n"
 				, PVT_ID(pvt), call_index, duration, end_status, cc_cause);
 		CPVT_RESET_FLAGS(cpvt, CALL_FLAG_NEED_HANGUP);
-		PVT_STAT(pvt, calls_duration[cpvt->dir]) += duration;
+		PVT_STAT_ADD(pvt, calls_duration[cpvt->dir], duration);
 		change_channel_state(cpvt, CALL_STATE_RELEASED, cc_cause);
 		manager_event_cend(PVT_ID(pvt), call_index, duration, end_status, cc_cause);
 	}
@@ -152,7 +153,7 @@ static int at_response_cend (struct pvt * pvt, const char* str)
                 ast_debug (1,	"[%s] CEND: call_index %d duration %d end_status %d cc_cause %d Line disconnected\n"
 				, PVT_ID(pvt), call_index, duration, end_status, cc_cause);
 		CPVT_RESET_FLAGS(cpvt, CALL_FLAG_NEED_HANGUP);
-		PVT_STAT(pvt, calls_duration[cpvt->dir]) += duration;
+		PVT_STAT_ADD(pvt, calls_duration[cpvt->dir], duration);
 		change_channel_state(cpvt, CALL_STATE_RELEASED, cc_cause);
 		manager_event_cend(PVT_ID(pvt), call_index, duration, end_status, cc_cause);
 	}
@@ -167,7 +168,7 @@ static int at_response_cend (struct pvt * pvt, const char* str)
 
 static int at_response_connect (struct pvt* pvt, const char* str, size_t len)
 {
-	char oa[512]="", mms_trxid[255], msg[160*255];
+	char oa[512]="", mms_trxid[255], *msg;
 	const at_queue_task_t * task = at_queue_head_task (pvt);
 	const at_queue_cmd_t * ecmd = at_queue_task_cmd(task);
 
@@ -192,11 +193,21 @@ static int at_response_connect (struct pvt* pvt, const char* str, size_t len)
 				len-=9;
 				pvt->connect_length = -1;
 				if(pvt->incoming_mms_trx_id) {
-					char *mms_pdu_hexified = ast_malloc(len*2+1);
-					hexify(str, len, mms_pdu_hexified);
-					ast_verb (3, "[%s] %s\n", PVT_ID(pvt), mms_pdu_hexified);
-					ast_free(mms_pdu_hexified);
+					/* hex dump of whole MMS body is only for debugging */
+					if (DEBUG_ATLEAST(1)) {
+						char *mms_pdu_hexified = ast_malloc(len*2+1);
+						if (mms_pdu_hexified) {
+							hexify(str, len, mms_pdu_hexified);
+							ast_debug (1, "[%s] %s\n", PVT_ID(pvt), mms_pdu_hexified);
+							ast_free(mms_pdu_hexified);
+						}
+					}
 
+					msg = pvt_scratch(pvt, 160 * 255);
+					if(!msg) {
+						ast_log (LOG_ERROR, "[%s] Not enough scratch memory for message\n", PVT_ID(pvt));
+						return 0;
+					}
 					if(at_parse_mms_pdu(str, len, oa, mms_trxid, msg) < 0) {
 						ast_log (LOG_ERROR, "[%s] %s: at_parse_mms_pdu returned non-zero", PVT_ID(pvt), __func__);
 						return 0;
@@ -204,8 +215,7 @@ static int at_response_connect (struct pvt* pvt, const char* str, size_t len)
 
 					{
 						char *text_base64 = ast_base64encode_string(msg);
-						manager_event_new_sms(PVT_ID(pvt), oa, msg);
-						manager_event_new_sms_base64(PVT_ID(pvt), oa, text_base64);
+						manager_event_sms(PVT_ID(pvt), oa, msg, text_base64);
 						channel_var_t vars[] =
 						{
 							{ "SMS", msg },
@@ -490,6 +500,14 @@ static int at_response_error (struct pvt* pvt, at_res_t res)
 	const at_queue_task_t * task = at_queue_head_task(pvt);
 	const at_queue_cmd_t * ecmd = at_queue_task_cmd(task);
 
+	if (ecmd)
+	{
+		if (res == RES_CMS_ERROR)
+			PVT_STAT_ADD(pvt, at_cms_errors[ecmd->cmd], 1);
+		else
+			PVT_STAT_ADD(pvt, at_errors[ecmd->cmd], 1);
+	}
+
 	if (ecmd && (ecmd->res == RES_OK || ecmd->res == RES_CMGR || ecmd->res == RES_SMS_PROMPT))
 	{
 		switch (ecmd->cmd)
@@ -685,6 +703,13 @@ static int at_response_error (struct pvt* pvt, at_res_t res)
 				pvt->outgoing_sms = 0;
 				pvt_try_restate(pvt);
 
+				if (smsdb_outgoing_pdu_failed(task->uid, CONF_SHARED(pvt, smsretries), CONF_SHARED(pvt, smsretrydelay)) > 0)
+				{
+					ast_verb (3, "[%s] Error sending SMS message %p, will be resent\n", PVT_ID(pvt), task);
+					log_cmd_response_error(pvt, ecmd, "[%s] Error sending SMS message %p %s, will be resent\n", PVT_ID(pvt), task, at_cmd2str (ecmd->cmd));
+					break;
+				}
+
 				{
 					char payload[SMSDB_PAYLOAD_MAX_LEN];
 					char dst[SMSDB_DST_MAX_LEN];
@@ -777,6 +802,8 @@ static int at_response_rssi (struct pvt* pvt, const char* str)
 		return -1;
 	}
 
+	if (pvt->rssi != rssi)
+		manager_event_signal(PVT_ID(pvt), rssi);
 	pvt->rssi = rssi;
 	return 0;
 }
@@ -850,7 +877,7 @@ static int at_response_orig (struct pvt* pvt, const char* str)
 */                
                         if (!pvt->is_simcom) pvt->t0 = uptime();
                         pvt->call_estb = 1;
-			PVT_STAT(pvt, calls_answered[cpvt->dir]) ++;
+			PVT_STAT_ADD(pvt, calls_answered[cpvt->dir], 1);
 			change_channel_state(cpvt, CALL_STATE_ACTIVE, 0);
 			if(CPVT_TEST_FLAG(cpvt, CALL_FLAG_CONFERENCE))
 				at_enqueue_conference(cpvt);
@@ -885,7 +912,7 @@ static int at_response_orig (struct pvt* pvt, const char* str)
                 if (pvt->call_estb) duration = uptime() - pvt->t0;
                 pvt->call_estb = 0;
 		CPVT_RESET_FLAGS(cpvt, CALL_FLAG_NEED_HANGUP);
-		PVT_STAT(pvt, calls_duration[cpvt->dir]) += duration;
+		PVT_STAT_ADD(pvt, calls_duration[cpvt->dir], duration);
 		change_channel_state(cpvt, CALL_STATE_RELEASED, cc_cause);
 		manager_event_cend(PVT_ID(pvt), call_index, duration, end_status, cc_cause);
 	}
@@ -1034,7 +1061,7 @@ static int at_response_cend (struct pvt * pvt, const char* str)
 	if (cpvt)
 	{
 		CPVT_RESET_FLAGS(cpvt, CALL_FLAG_NEED_HANGUP);
-		PVT_STAT(pvt, calls_duration[cpvt->dir]) += duration;
+		PVT_STAT_ADD(pvt, calls_duration[cpvt->dir], duration);
 		change_channel_state(cpvt, CALL_STATE_RELEASED, cc_cause);
 		manager_event_cend(PVT_ID(pvt), 3, duration, end_status, cc_cause);
 	}
@@ -1043,7 +1070,7 @@ static int at_response_cend (struct pvt * pvt, const char* str)
 	if (cpvt)
 	{
 		CPVT_RESET_FLAGS(cpvt, CALL_FLAG_NEED_HANGUP);
-		PVT_STAT(pvt, calls_duration[cpvt->dir]) += duration;
+		PVT_STAT_ADD(pvt, calls_duration[cpvt->dir], duration);
 		change_channel_state(cpvt, CALL_STATE_RELEASED, cc_cause);
 		manager_event_cend(PVT_ID(pvt), 4, duration, end_status, cc_cause);
 	}
@@ -1120,7 +1147,7 @@ static int at_response_conn (struct pvt* pvt, const char* str)
 		{
 /* FIXME: delay until CLCC handle?
 */
-			PVT_STAT(pvt, calls_answered[cpvt->dir]) ++;
+			PVT_STAT_ADD(pvt, calls_answered[cpvt->dir], 1);
 			change_channel_state(cpvt, CALL_STATE_ACTIVE, 0);
 			if(CPVT_TEST_FLAG(cpvt, CALL_FLAG_CONFERENCE))
 				at_enqueue_conference(cpvt);
@@ -1257,20 +1284,20 @@ static int at_response_clcc (struct pvt* pvt, char* str)
 					else if(dir == CALL_DIR_INCOMING && (state == CALL_STATE_INCOMING || state == CALL_STATE_WAITING))
 					{
 						if(state == CALL_STATE_INCOMING)
-							PVT_STAT(pvt, in_calls) ++;
+							PVT_STAT_ADD(pvt, in_calls, 1);
 						else
-							PVT_STAT(pvt, cw_calls) ++;
+							PVT_STAT_ADD(pvt, cw_calls, 1);
 						if(pvt_enabled(pvt))
 						{
 							/* TODO: give dialplan level user tool for checking device is voice enabled or not  */
 							if(start_pbx(pvt, number, call_idx, state) == 0)
 							{
-								PVT_STAT(pvt, in_calls_handled) ++;
+								PVT_STAT_ADD(pvt, in_calls_handled, 1);
 								if(!pvt->has_voice)
 									ast_log (LOG_WARNING, "[%s] pbx started for device not voice capable\n", PVT_ID(pvt));
 							}
 							else
-								PVT_STAT(pvt, in_pbx_fails) ++;
+								PVT_STAT_ADD(pvt, in_pbx_fails, 1);
 						}
 					}
 
@@ -1471,6 +1498,15 @@ at_poll_sms (struct pvt *pvt)
 	}
 }
 
+/* buffers of SMS handlers, taken from the device arena instead of the stack */
+struct sms_scratch
+{
+	char		msg[4096];
+	char		text_base64[40800];
+	char		fullmsg[160 * 255];
+	char		wsp[160 * 255 / 2];
+};
+
 /*!
  * \brief Handle +CMT response
  * \param pvt -- pvt structure
@@ -1485,14 +1521,13 @@ static int at_response_cmt (struct pvt* pvt, const char * str, size_t len)
 	char		oa[512] = "", sca[512] = "";
 	char scts[64], dt[64];
 	int mr, st;
-	char		msg[4096];
 	int		res;
-	char		text_base64[40800];
-	size_t		msg_len = sizeof(msg);
+	struct sms_scratch *sb = pvt_scratch(pvt, sizeof(*sb));
+	char		*msg, *text_base64, *fullmsg;
+	size_t		msg_len = sizeof(sb->msg);
 	int tpdu_type;
 	pdu_udh_t	udh;
 	pdu_udh_init(&udh);
-	char fullmsg[160 * 255];
 	int fullmsg_len;
 	int csms_cnt;
 	char buf[512];
@@ -1503,9 +1538,17 @@ static int at_response_cmt (struct pvt* pvt, const char * str, size_t len)
 	manager_event_message("QuectelNewCMT", PVT_ID(pvt), str);
 	at_queue_handle_result (pvt, RES_CMT);
 
+	if (!sb) {
+		ast_log(LOG_ERROR, "[%s] Not enough scratch memory for message\n", PVT_ID(pvt));
+		return 0;
+	}
+	msg = sb->msg;
+	text_base64 = sb->text_base64;
+	fullmsg = sb->fullmsg;
+
 	res = at_parse_cmt(str, len, &tpdu_type, sca, sizeof(sca), oa, sizeof(oa), scts, &mr, &st, dt, msg, &msg_len, &udh);
 	if (res < 0) {
-		ast_base64encode (text_base64, str, len, sizeof(text_base64));
+		ast_base64encode (text_base64, str, len, sizeof(sb->text_base64));
 		ast_log(LOG_WARNING, "[%s] Error parsing incoming message: %s [%s]\n", PVT_ID(pvt), error2str(chan_quectel_err), text_base64);
 		return 0;
 	}
@@ -1563,7 +1606,7 @@ receive_as_is:
 
 		if(udh.dst_port && udh.src_port) {
 			ast_verb (1, "[%s] WSP detected. Call wsp_parse\n", PVT_ID(pvt));
-			char wsp[sizeof(fullmsg)/2];
+			char *wsp = sb->wsp;
 			int wsp_length = (unhex(fullmsg, wsp) + 1) / 2;
 			char mms_trxid[64]="", mms_url[255]="";
 			res = wsp_parse (wsp, wsp_length, udh.dst_port, udh.src_port, oa, mms_trxid, mms_url, fullmsg);
@@ -1590,10 +1633,9 @@ receive_as_is:
 			return 0;
 		}
 		ast_verb (1, "[%s] Got full SMS from %s: '%s'\n", PVT_ID(pvt), oa, fullmsg);
-		ast_base64encode (text_base64, (unsigned char*)fullmsg, fullmsg_len, sizeof(text_base64));
+		ast_base64encode (text_base64, (unsigned char*)fullmsg, fullmsg_len, sizeof(sb->text_base64));
 
-		manager_event_new_sms(PVT_ID(pvt), oa, fullmsg);
-		manager_event_new_sms_base64(PVT_ID(pvt), oa, text_base64);
+		manager_event_sms(PVT_ID(pvt), oa, fullmsg, text_base64);
 		{
 			channel_var_t vars[] =
 			{
@@ -1705,14 +1747,13 @@ static int at_response_cmgr (struct pvt* pvt, const char * str, size_t len)
 	char		oa[512] = "", sca[512] = "";
 	char scts[64], dt[64];
 	int mr, st;
-	char		msg[4096];
 	int		res;
-	char		text_base64[40800];
-	size_t		msg_len = sizeof(msg);
+	struct sms_scratch *sb = pvt_scratch(pvt, sizeof(*sb));
+	char		*msg, *text_base64, *fullmsg;
+	size_t		msg_len = sizeof(sb->msg);
 	int tpdu_type;
 	pdu_udh_t	udh;
 	pdu_udh_init(&udh);
-	char fullmsg[160 * 255];
 	int fullmsg_len;
 	int csms_cnt;
 	char buf[512];
@@ -1727,9 +1768,17 @@ static int at_response_cmgr (struct pvt* pvt, const char * str, size_t len)
 		if (ecmd->res == RES_CMGR || ecmd->cmd == CMD_USER) {
 			at_queue_handle_result (pvt, RES_CMGR);
 
+			if (!sb) {
+				ast_log(LOG_ERROR, "[%s] Not enough scratch memory for message\n", PVT_ID(pvt));
+				goto receive_next_no_delete;
+			}
+			msg = sb->msg;
+			text_base64 = sb->text_base64;
+			fullmsg = sb->fullmsg;
+
 			res = at_parse_cmgr(str, len, &tpdu_type, sca, sizeof(sca), oa, sizeof(oa), scts, &mr, &st, dt, msg, &msg_len, &udh);
 			if (res < 0) {
-				ast_base64encode (text_base64, str, len, sizeof(text_base64));
+				ast_base64encode (text_base64, str, len, sizeof(sb->text_base64));
 				ast_log(LOG_WARNING, "[%s] Error parsing incoming message: %s [%s]\n", PVT_ID(pvt), error2str(chan_quectel_err), text_base64);
 				goto receive_next_no_delete;
 			}
@@ -1787,10 +1836,9 @@ receive_as_is:
 				}
 
 				ast_verb (1, "[%s] Got full SMS from %s: '%s'\n", PVT_ID(pvt), oa, fullmsg);
-				ast_base64encode (text_base64, (unsigned char*)fullmsg, fullmsg_len, sizeof(text_base64));
+				ast_base64encode (text_base64, (unsigned char*)fullmsg, fullmsg_len, sizeof(sb->text_base64));
 
-				manager_event_new_sms(PVT_ID(pvt), oa, fullmsg);
-				manager_event_new_sms_base64(PVT_ID(pvt), oa, text_base64);
+				manager_event_sms(PVT_ID(pvt), oa, fullmsg, text_base64);
 				{
 					channel_var_t vars[] =
 					{
@@ -1877,7 +1925,7 @@ static int at_response_cusd (struct pvt * pvt, char * str, size_t len)
 	char*		cusd;
 	int		dcs;
 	char		cusd_utf8_str[1024];
-	char		text_base64[16384];
+	char		*text_base64;
 	char		typebuf[2];
 	const char*	typestr;
 
@@ -1935,7 +1983,13 @@ static int at_response_cusd (struct pvt * pvt, char * str, size_t len)
 	cusd_utf8_str[res] = '\0';
 
 	ast_verb (1, "[%s] Got USSD type %d '%s': '%s'\n", PVT_ID(pvt), type, typestr, cusd_utf8_str);
-	ast_base64encode (text_base64, (unsigned char*)cusd_utf8_str, res, sizeof(text_base64));
+	text_base64 = pvt_scratch(pvt, 16384);
+	if (!text_base64) {
+		/* not worth device restart */
+		ast_log (LOG_ERROR, "[%s] Not enough scratch memory for USSD\n", PVT_ID(pvt));
+		return 0;
+	}
+	ast_base64encode (text_base64, (unsigned char*)cusd_utf8_str, res, 16384);
 
 	// TODO: pass type
 	manager_event_new_ussd(PVT_ID(pvt), cusd_utf8_str);
@@ -2011,7 +2065,11 @@ static int at_response_csq (struct pvt* pvt, const char* str)
 	if(rv)
 		ast_debug (2, "[%s] Error parsing +CSQ result '%s'\n", PVT_ID(pvt), str);
 	else
+	{
+		if (pvt->rssi != rssi)
+			manager_event_signal(PVT_ID(pvt), rssi);
 		pvt->rssi = rssi;
+	}
 	return rv;
 }
 
@@ -2179,11 +2237,33 @@ static int at_response_cgmr (struct pvt* pvt, const char* str)
  * \retval -1 error
  */
 
+/*!
+ * \brief Check IMEI or IMSI read from device matches the one its ports were discovered by
+ * \param pvt -- pvt structure
+ * \param what -- "IMEI" or "IMSI"
+ * \param conf -- configured value, empty if device is not selected by it
+ * \param got -- value reported by device
+ * \retval  0 match or ports not discovered
+ * \retval -1 discovery used stale IMEI/IMSI, ports are forgotten and device restarted
+ */
+
+static int at_response_discovered (struct pvt* pvt, const char* what, const char* conf, const char* got)
+{
+	if (CONF_UNIQ(pvt, data_tty)[0] != 0 || conf[0] == 0 || strcmp (conf, got) == 0)
+	{
+		return 0;
+	}
+
+	ast_log (LOG_WARNING, "[%s] Ports were found by %s %s but device reports %s, discovering again\n", PVT_ID(pvt), what, conf, got);
+	pdiscovery_forget (CONF_UNIQ(pvt, imei), CONF_UNIQ(pvt, imsi));
+	return -1;
+}
+
 static int at_response_cgsn (struct pvt* pvt, const char* str)
 {
 	ast_copy_string (pvt->imei, str, sizeof (pvt->imei));
 
-	return 0;
+	return at_response_discovered (pvt, "IMEI", CONF_UNIQ(pvt, imei), pvt->imei);
 }
 
 /*!
@@ -2199,7 +2279,7 @@ static int at_response_cimi (struct pvt* pvt, const char* str)
 {
 	ast_copy_string (pvt->imsi, str, sizeof (pvt->imsi));
 
-	return 0;
+	return at_response_discovered (pvt, "IMSI", CONF_UNIQ(pvt, imsi), pvt->imsi);
 }
 
 static void at_response_busy(struct pvt* pvt, enum ast_control_frame_type control)
@@ -2280,36 +2360,22 @@ static int at_response_qhttpread(struct pvt* pvt, const char* str)
 /*!
  * \brief Do response
  * \param pvt -- pvt structure
- * \param iovcnt -- number of elements array pvt->d_read_iov
+ * \param str -- response, contiguous and writable
+ * \param len -- response length, last byte is replaced by terminating zero
  * \param at_res -- result type
  * \retval  0 success
  * \retval -1 error
  */
 
-int at_response (struct pvt* pvt, const struct iovec iov[2], int iovcnt, at_res_t at_res)
+int at_response (struct pvt* pvt, char* str, size_t len, at_res_t at_res)
 {
-	char*		str;
-	size_t		len;
 	const at_queue_task_t *task = at_queue_head_task(pvt);
 	const at_queue_cmd_t *ecmd = at_queue_task_cmd(task);
 
 
-	if(iov[0].iov_len + iov[1].iov_len > 0)
+	if(len > 0)
 	{
-		len = iov[0].iov_len + iov[1].iov_len - 1;
-
-		if (iovcnt == 2)
-		{
-			ast_debug (5, "[%s] iovcnt == 2\n", PVT_ID(pvt));
-
-			str = alloca(len + 1);
-			memcpy(str, iov[0].iov_base, iov[0].iov_len);
-			memcpy(str + iov[0].iov_len, iov[1].iov_base, iov[1].iov_len);
-		}
-		else
-		{
-			str = iov[0].iov_base;
-		}
+		len--;
 		str[len] = '\0';
 
 // 		ast_debug (5, "[%s] [%.*s]\n", PVT_ID(pvt), (int) len, str);
@@ -7,7 +7,6 @@
 #include "export.h"			/* EXPORT_DECL EXPORT_DEF */
 
 struct pvt;
-struct iovec;
 
 /* AT_RESPONSES_TABLE */
 #define AT_RES_AS_ENUM(res, desc, str) RES_ ## res,
@@ -106,7 +105,7 @@ typedef struct at_responses_t
 /*! responses description */
 EXPORT_DECL const at_responses_t at_responses;
 EXPORT_DECL const char* at_res2str (at_res_t res);
-EXPORT_DECL int at_response (struct pvt* pvt, const struct iovec * iov, int iovcnt, at_res_t at_res);
+EXPORT_DECL int at_response (struct pvt* pvt, char* str, size_t len, at_res_t at_res);
 EXPORT_DECL int at_poll_sms (struct pvt* pvt);
 
 #endif /* CHAN_QUECTEL_AT_RESPONSE_H_INCLUDED */
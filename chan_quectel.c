@@ -50,6 +50,12 @@ ASTERISK_FILE_VERSION(__FILE__, "$Rev: " PACKAGE_REVISION " $")
 #include <pthread.h>			/* pthread_t pthread_kill() pthread_join() */
 #include <fcntl.h>			/* O_RDWR O_NOCTTY */
 #include <signal.h>			/* SIGURG */
+#include <sched.h>			/* sched_yield() */
+#include <poll.h>			/* poll() */
+#include <sys/socket.h>			/* socket() bind() recv() */
+#ifdef __linux__
+#include <linux/netlink.h>		/* NETLINK_KOBJECT_UEVENT struct sockaddr_nl */
+#endif /* __linux__ */
 
 #include "ast_compat.h"			/* asterisk compatibility fixes */
 
@@ -67,9 +73,10 @@ ASTERISK_FILE_VERSION(__FILE__, "$Rev: " PACKAGE_REVISION " $")
 #include "cli.h"
 #include "app.h"
 #include "manager.h"
+#include "metrics.h"			/* metrics_register() */
 #include "channel.h"			/* channel_queue_hangup() */
 #include "dc_config.h"			/* dc_uconfig_fill() dc_gconfig_fill() dc_sconfig_fill()  */
-#include "pdiscovery.h"			/* pdiscovery_lookup() pdiscovery_init() pdiscovery_fini() */
+#include "pdiscovery.h"			/* pdiscovery_lookup() pdiscovery_refresh() pdiscovery_init() pdiscovery_fini() */
 #include "smsdb.h"
 #include "error.h"
 #include "errno.h"
@@ -401,6 +408,26 @@ EXPORT_DEF int opentty (const char* dev, char ** lockfile, int typ)
 	return fd;
 }
 
+#/* */
+static void sms_spool_flush(struct pvt *pvt)
+{
+	at_sms_t *sms;
+
+	while ((sms = AST_LIST_REMOVE_HEAD (&pvt->sms_spool, entry))) {
+		smsdb_outgoing_pdu_unspool(sms->uid, 0);
+		ast_free(sms);
+	}
+	pvt->sms_spool_count = 0;
+
+	/* queue is lost, unconfirmed parts are resent by this or other device of group */
+	if (pvt->imsi[0]) {
+		int parts = smsdb_outgoing_pdu_reset(pvt->imsi);
+		if (parts > 0) {
+			ast_log (LOG_NOTICE, "[%s] %d unconfirmed SMS part(s) will be resent\n", PVT_ID(pvt), parts);
+		}
+	}
+}
+
 #/* phone monitor thread pvt cleanup */
 static void disconnect_quectel (struct pvt* pvt)
 {
@@ -419,7 +446,9 @@ static void disconnect_quectel (struct pvt* pvt)
 		}
 	}
 	at_queue_flush(pvt);
+	sms_spool_flush(pvt);
 	pvt->last_dialed_cpvt = NULL;
+	ast_mutex_lock (&pvt->a_lock);
         if (strcmp(CONF_UNIQ(pvt, quec_uac),"1") == 0) {
 	if (pvt->icard) snd_pcm_close(pvt->icard);
 	if (pvt->ocard)	snd_pcm_close(pvt->ocard);
@@ -433,11 +462,12 @@ static void disconnect_quectel (struct pvt* pvt)
 
 	if(pvt->dsp)
 		ast_dsp_digitreset(pvt->dsp);
+	pvt->dtmf_digit = 0;
+	ast_mutex_unlock (&pvt->a_lock);
 	pvt_on_remove_last_channel(pvt);
 
 /*	pvt->a_write_rb */
 
-	pvt->dtmf_digit = 0;
 	pvt->rings = 0;
 
 //	else
@@ -488,6 +518,7 @@ static void disconnect_quectel (struct pvt* pvt)
 	ast_copy_string (PVT_STATE(pvt, data_tty),  CONF_UNIQ(pvt, data_tty), sizeof (PVT_STATE(pvt, data_tty)));
 	ast_copy_string (PVT_STATE(pvt, audio_tty), CONF_UNIQ(pvt, audio_tty), sizeof (PVT_STATE(pvt, audio_tty)));
 
+	pvt_status_publish(pvt);
 	ast_verb (3, "[%s] Quectel has disconnected\n", PVT_ID(pvt));
 
 	manager_event_device_status(PVT_ID(pvt), "Disconnect");
@@ -538,6 +569,470 @@ EXPORT_DEF int is_sms_inbox_set(const struct pvt* pvt, int index)
 #undef SMS_INBOX_INDEX
 #undef SMS_INBOX_BIT
 
+/*!
+ * \brief Take memory from the device scratch arena
+ * \param size -- number of bytes
+ * \return aligned block valid until the next response, NULL if arena is exhausted
+ *
+ * Used by the monitor thread for response handlers instead of large stack buffers.
+ */
+EXPORT_DEF void * pvt_scratch(struct pvt * pvt, size_t size)
+{
+	size_t off = (pvt->scratch_used + 15) & ~(size_t) 15;
+
+	if (!pvt->scratch || off > PVT_SCRATCH_SIZE || size > PVT_SCRATCH_SIZE - off)
+	{
+		return NULL;
+	}
+	pvt->scratch_used = off + size;
+	return pvt->scratch + off;
+}
+
+#/* append device to array growing it as needed */
+static int pvt_array_push(struct pvt *** pvts, unsigned * count, unsigned * size, struct pvt * pvt)
+{
+	struct pvt ** tmp;
+
+	if (*count == *size)
+	{
+		tmp = ast_realloc(*pvts, (*size + 8) * sizeof(*tmp));
+		if (!tmp)
+		{
+			return -1;
+		}
+		*pvts = tmp;
+		*size += 8;
+	}
+	(*pvts)[(*count)++] = pvt;
+	return 0;
+}
+
+#/* remove device from set, index_lock must be write locked */
+static void pvt_members_leave(struct pvt_members * members, struct pvt * pvt)
+{
+	unsigned i;
+
+	for (i = 0; i < members->count; ++i)
+	{
+		if (members->pvts[i] == pvt)
+		{
+			memmove(&members->pvts[i], &members->pvts[i + 1], (members->count - i - 1) * sizeof(members->pvts[0]));
+			members->count--;
+			break;
+		}
+	}
+}
+
+#/* add device to set of group or provider, index_lock must be write locked */
+static struct pvt_members * pvt_members_join(struct pvt_members ** sets, int group, const char * provider, struct pvt * pvt)
+{
+	struct pvt_members * members;
+
+	for (members = *sets; members; members = members->next)
+	{
+		if (members->group == group && !strcmp(members->provider, provider))
+		{
+			break;
+		}
+	}
+	if (!members)
+	{
+		/* sets live until unload, so cursor pointers stay valid */
+		members = ast_calloc(1, sizeof(*members));
+		if (!members)
+		{
+			return NULL;
+		}
+		members->group = group;
+		ast_copy_string(members->provider, provider, sizeof(members->provider));
+		members->next = *sets;
+		*sets = members;
+	}
+	if (pvt_array_push(&members->pvts, &members->count, &members->size, pvt))
+	{
+		return NULL;
+	}
+	return members;
+}
+
+/*!
+ * \brief Move device to sets of its group and provider
+ * \param state -- public state
+ * \param pvt -- device, nothing is done until it is in devices list
+ * \param group -- group of device
+ * \param provider -- provider name, empty if none
+ */
+static void pvt_members_update(struct public_state * state, struct pvt * pvt, int group, const char * provider)
+{
+	ast_rwlock_wrlock(&state->index_lock);
+	/* device is indexed by name when added to list */
+	if (!pvt->index_nodes[PVT_INDEX_ID].linked)
+	{
+		ast_rwlock_unlock(&state->index_lock);
+		return;
+	}
+	if (!pvt->group_members || pvt->group_members->group != group)
+	{
+		if (pvt->group_members)
+		{
+			pvt_members_leave(pvt->group_members, pvt);
+		}
+		pvt->group_members = pvt_members_join(&state->groups, group, "", pvt);
+	}
+	if (pvt->provider_members ? strcmp(pvt->provider_members->provider, provider) : provider[0] != 0)
+	{
+		if (pvt->provider_members)
+		{
+			pvt_members_leave(pvt->provider_members, pvt);
+		}
+		pvt->provider_members = provider[0] ? pvt_members_join(&state->providers, 0, provider, pvt) : NULL;
+	}
+	ast_rwlock_unlock(&state->index_lock);
+}
+
+/*!
+ * \brief Copy devices of group or provider
+ * \param state -- public state, devices list must be locked for keep result valid
+ * \param sets -- &state->groups or &state->providers
+ * \param group -- group, 0 for provider
+ * \param provider -- provider, empty for group
+ * \param count -- number of devices returned
+ * \param cursor -- round robin cursor of set or NULL if not required
+ * \return ast_malloc()ed array or NULL if set empty
+ */
+static struct pvt ** pvt_members_get(struct public_state * state, struct pvt_members * const * sets, int group, const char * provider, unsigned * count, unsigned int ** cursor)
+{
+	struct pvt_members * members;
+	struct pvt ** pvts = NULL;
+
+	*count = 0;
+	ast_rwlock_rdlock(&state->index_lock);
+	for (members = *sets; members; members = members->next)
+	{
+		if (members->group == group && !strcmp(members->provider, provider))
+		{
+			if (members->count && (pvts = ast_malloc(members->count * sizeof(*pvts))))
+			{
+				memcpy(pvts, members->pvts, members->count * sizeof(*pvts));
+				*count = members->count;
+				if (cursor)
+				{
+					*cursor = &members->cursor;
+				}
+			}
+			break;
+		}
+	}
+	ast_rwlock_unlock(&state->index_lock);
+
+	return pvts;
+}
+
+#/* free all sets, on unload */
+static void pvt_members_free(struct pvt_members ** sets)
+{
+	struct pvt_members * members;
+
+	while ((members = *sets))
+	{
+		*sets = members->next;
+		ast_free(members->pvts);
+		ast_free(members);
+	}
+}
+
+#/* remove node from bucket, index_lock must be write locked */
+static void pvt_index_unlink(struct public_state * state, pvt_index_t which, struct pvt_index_node * node)
+{
+	struct pvt_index_node ** link;
+
+	for (link = &state->index[which][node->hash % PVT_INDEX_SIZE]; *link; link = &(*link)->next)
+	{
+		if (*link == node)
+		{
+			*link = node->next;
+			break;
+		}
+	}
+	node->next = NULL;
+	node->linked = 0;
+}
+
+/*!
+ * \brief Change value of device in index
+ * \param state -- public state
+ * \param pvt -- device
+ * \param which -- index
+ * \param key -- new value, empty for remove device from index
+ */
+static void pvt_index_set(struct public_state * state, struct pvt * pvt, pvt_index_t which, const char * key)
+{
+	struct pvt_index_node * node = &pvt->index_nodes[which];
+	struct pvt_index_node ** bucket;
+
+	ast_rwlock_wrlock(&state->index_lock);
+	if (!node->linked || strcmp(node->key, key))
+	{
+		if (node->linked)
+		{
+			pvt_index_unlink(state, which, node);
+		}
+		if (key[0])
+		{
+			ast_copy_string(node->key, key, sizeof(node->key));
+			node->pvt = pvt;
+			node->hash = ast_str_hash(node->key);
+			bucket = &state->index[which][node->hash % PVT_INDEX_SIZE];
+			node->next = *bucket;
+			*bucket = node;
+			node->linked = 1;
+		}
+	}
+	ast_rwlock_unlock(&state->index_lock);
+}
+
+#/* remove device from all indexes and sets */
+static void pvt_index_del(struct public_state * state, struct pvt * pvt)
+{
+	unsigned which;
+
+	ast_rwlock_wrlock(&state->index_lock);
+	for (which = 0; which < PVT_INDEX_COUNT; ++which)
+	{
+		if (pvt->index_nodes[which].linked)
+		{
+			pvt_index_unlink(state, which, &pvt->index_nodes[which]);
+		}
+	}
+	if (pvt->group_members)
+	{
+		pvt_members_leave(pvt->group_members, pvt);
+		pvt->group_members = NULL;
+	}
+	if (pvt->provider_members)
+	{
+		pvt_members_leave(pvt->provider_members, pvt);
+		pvt->provider_members = NULL;
+	}
+	ast_rwlock_unlock(&state->index_lock);
+}
+
+/*!
+ * \brief Find device in index
+ * \param state -- public state, devices list must be locked for keep result valid
+ * \param which -- index
+ * \param key -- value
+ * \return unlocked pvt or NULL
+ */
+static struct pvt * pvt_index_find(struct public_state * state, pvt_index_t which, const char * key)
+{
+	struct pvt_index_node * node;
+	struct pvt * pvt = NULL;
+	unsigned int hash = ast_str_hash(key);
+
+	ast_rwlock_rdlock(&state->index_lock);
+	for (node = state->index[which][hash % PVT_INDEX_SIZE]; node; node = node->next)
+	{
+		if (node->hash == hash && !strcmp(node->key, key))
+		{
+			pvt = node->pvt;
+			break;
+		}
+	}
+	ast_rwlock_unlock(&state->index_lock);
+
+	return pvt;
+}
+
+/*!
+ * \brief Publish device state for readers which must not wait for pvt lock
+ * \param pvt -- locked pvt
+ *
+ * Called after each change of state by monitor thread and state machine,
+ * readers take consistent copy with pvt_status_get() even while pvt is locked.
+ */
+EXPORT_DEF void pvt_status_publish(struct pvt * pvt)
+{
+	struct pvt_status status;
+	unsigned int seq;
+
+	memset(&status, 0, sizeof(status));
+	status.state = pvt_str_state(pvt);
+	status.group = CONF_SHARED(pvt, group);
+	status.gsm_reg_status = pvt->gsm_reg_status;
+	status.rssi = pvt->rssi;
+	status.linkmode = pvt->linkmode;
+	status.linksubmode = pvt->linksubmode;
+	status.ready4voice = pvt->connected && pvt->initialized && pvt->has_voice && pvt->gsm_registered && pvt_enabled(pvt);
+	status.ready4sms = ready4sms(pvt);
+	ast_copy_string(status.provider_name, pvt->provider_name, sizeof(status.provider_name));
+	ast_copy_string(status.model, pvt->model, sizeof(status.model));
+	ast_copy_string(status.firmware, pvt->firmware, sizeof(status.firmware));
+	ast_copy_string(status.imei, pvt->imei, sizeof(status.imei));
+	ast_copy_string(status.imsi, pvt->imsi, sizeof(status.imsi));
+	ast_copy_string(status.subscriber_number, pvt->subscriber_number, sizeof(status.subscriber_number));
+
+	/* sets are joined when device is added to list, joining failed for lack of memory is retried here */
+	if (!pvt->group_members || pvt->group_members->group != status.group
+		|| (pvt->provider_members ? strcmp(pvt->provider_members->provider, status.provider_name) : status.provider_name[0] != 0))
+	{
+		pvt_members_update(gpublic, pvt, status.group, status.provider_name);
+	}
+
+	if (!memcmp(&status, &pvt->status, sizeof(status)))
+	{
+		return;
+	}
+
+	if (strcmp(status.imei, pvt->status.imei))
+	{
+		pvt_index_set(gpublic, pvt, PVT_INDEX_IMEI, status.imei);
+	}
+	if (strcmp(status.imsi, pvt->status.imsi))
+	{
+		pvt_index_set(gpublic, pvt, PVT_INDEX_IMSI, status.imsi);
+	}
+	/* single writer under pvt lock, sequence is odd while copying */
+	seq = pvt->status_seq;
+	__atomic_store_n(&pvt->status_seq, seq + 1, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+	memcpy(&pvt->status, &status, sizeof(status));
+	__atomic_store_n(&pvt->status_seq, seq + 2, __ATOMIC_RELEASE);
+}
+
+#/* copy of state published by pvt_status_publish(), pvt may be unlocked */
+EXPORT_DEF void pvt_status_get(const struct pvt * pvt, struct pvt_status * status)
+{
+	unsigned int seq;
+
+	for (;;)
+	{
+		seq = __atomic_load_n(&pvt->status_seq, __ATOMIC_ACQUIRE);
+		if (seq & 1)
+		{
+			sched_yield();
+			continue;
+		}
+		memcpy(status, (const void *) &pvt->status, sizeof(*status));
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+		if (__atomic_load_n(&pvt->status_seq, __ATOMIC_RELAXED) == seq)
+		{
+			break;
+		}
+	}
+}
+
+#/* copy statistics, counters are read atomically and pvt lock is not required */
+EXPORT_DEF void pvt_stat_get(const struct pvt * pvt, pvt_stat_t * stat)
+{
+	stat_copy((uint64_t *) stat, (const uint64_t *) &pvt->stat, sizeof(*stat) / sizeof(uint64_t));
+}
+
+#/* copy queue and channel gauges without pvt lock, each one is read atomically, tty names are not copied */
+EXPORT_DEF void pvt_state_get(const struct pvt * pvt, pvt_state_t * state)
+{
+	unsigned i;
+
+	memset(state, 0, sizeof(*state));
+	state->at_tasks = __atomic_load_n(&PVT_STATE(pvt, at_tasks), __ATOMIC_RELAXED);
+	state->at_cmds = __atomic_load_n(&PVT_STATE(pvt, at_cmds), __ATOMIC_RELAXED);
+	state->chansno = __atomic_load_n(&PVT_STATE(pvt, chansno), __ATOMIC_RELAXED);
+	for (i = 0; i < CALL_STATES_NUMBER; i++)
+	{
+		state->chan_count[i] = __atomic_load_n(&PVT_STATE(pvt, chan_count[i]), __ATOMIC_RELAXED);
+	}
+}
+
+/*!
+ * \brief Copy device for output without holding locks
+ * \param pvt -- locked pvt
+ * \param snap -- result
+ */
+EXPORT_DEF void pvt_snapshot_fill(const struct pvt * pvt, struct pvt_snapshot * snap)
+{
+	struct ast_str * statebuf = pvt_str_state_ex(pvt);
+
+	memcpy(&snap->settings, &pvt->settings, sizeof(snap->settings));
+	memcpy(&snap->state, &pvt->state, sizeof(snap->state));
+	snap->str_state = pvt_str_state(pvt);
+	ast_copy_string(snap->str_state_ex, statebuf ? ast_str_buffer(statebuf) : "", sizeof(snap->str_state_ex));
+	ast_free(statebuf);
+	snap->gsm_reg_status = pvt->gsm_reg_status;
+	snap->rssi = pvt->rssi;
+	snap->linkmode = pvt->linkmode;
+	snap->linksubmode = pvt->linksubmode;
+	ast_copy_string(snap->provider_name, pvt->provider_name, sizeof(snap->provider_name));
+	ast_copy_string(snap->manufacturer, pvt->manufacturer, sizeof(snap->manufacturer));
+	ast_copy_string(snap->model, pvt->model, sizeof(snap->model));
+	ast_copy_string(snap->firmware, pvt->firmware, sizeof(snap->firmware));
+	ast_copy_string(snap->imei, pvt->imei, sizeof(snap->imei));
+	ast_copy_string(snap->imsi, pvt->imsi, sizeof(snap->imsi));
+	ast_copy_string(snap->subscriber_number, pvt->subscriber_number, sizeof(snap->subscriber_number));
+	ast_copy_string(snap->location_area_code, pvt->location_area_code, sizeof(snap->location_area_code));
+	ast_copy_string(snap->cell_id, pvt->cell_id, sizeof(snap->cell_id));
+	ast_copy_string(snap->sms_scenter, pvt->sms_scenter, sizeof(snap->sms_scenter));
+	snap->use_ucs2_encoding = pvt->use_ucs2_encoding;
+	snap->has_voice = pvt->has_voice;
+	snap->has_sms = pvt->has_sms;
+	snap->has_call_waiting = pvt->has_call_waiting;
+	snap->current_state = pvt->current_state;
+	snap->desired_state = pvt->desired_state;
+	snap->restart_time = pvt->restart_time;
+}
+
+/*!
+ * \brief Copy one or all devices for output without holding locks
+ * \param device -- device name or empty for all
+ * \param count -- number of returned snapshots
+ * \return ast_malloc()ed array or NULL if nothing found
+ */
+EXPORT_DEF struct pvt_snapshot * pvt_snapshot_list(const char * device, size_t * count)
+{
+	struct pvt * pvt;
+	struct pvt_snapshot * snaps = NULL;
+	struct pvt_snapshot * tmp;
+	size_t size = 0;
+
+	*count = 0;
+	if (!ast_strlen_zero(device))
+	{
+		pvt = find_device(device);
+		if (pvt)
+		{
+			snaps = ast_malloc(sizeof(*snaps));
+			if (snaps)
+			{
+				pvt_snapshot_fill(pvt, snaps);
+				*count = 1;
+			}
+			ast_mutex_unlock (&pvt->lock);
+		}
+		return snaps;
+	}
+
+	AST_RWLIST_RDLOCK(&gpublic->devices);
+	AST_RWLIST_TRAVERSE(&gpublic->devices, pvt, entry)
+	{
+		if (*count == size)
+		{
+			tmp = ast_realloc(snaps, (size + 8) * sizeof(*snaps));
+			if (!tmp)
+			{
+				break;
+			}
+			snaps = tmp;
+			size += 8;
+		}
+		/* each device locked only for copy */
+		ast_mutex_lock (&pvt->lock);
+		pvt_snapshot_fill(pvt, &snaps[(*count)++]);
+		ast_mutex_unlock (&pvt->lock);
+	}
+	AST_RWLIST_UNLOCK(&gpublic->devices);
+
+	return snaps;
+}
+
 /* anybody wrote some to device before me, and not read results, clean pending results here */
 #/* */
 EXPORT_DEF void clean_read_data(const char * devname, int fd)
@@ -581,6 +1076,92 @@ static void handle_expired_reports(struct pvt *pvt)
 	}
 }
 
+#define SMS_RESUME_INTERVAL	5				/* seconds between smsdb polls for messages to resend */
+#define SMS_RESUME_TAKEOVER	60				/* seconds after which message of other device of group is taken over */
+#define SMS_RESUME_SPOOL_MAX	16				/* do not resume more if spool is longer */
+
+/*!
+ * \brief Move SMS messages waiting in smsdb for (re)send to device spool
+ * \param pvt -- locked pvt structure
+ */
+#/* */
+static void handle_sms_resume(struct pvt *pvt)
+{
+	at_sms_t *sms;
+
+	if (!pvt->initialized || !pvt->gsm_registered || !pvt->has_sms || ast_tvcmp(ast_tvnow(), pvt->sms_resume_next) < 0) {
+		return;
+	}
+	pvt->sms_resume_next = ast_tvadd(ast_tvnow(), ast_samp2tv(SMS_RESUME_INTERVAL, 1));
+
+	while (pvt->sms_spool_count < SMS_RESUME_SPOOL_MAX) {
+		sms = at_sms_resume(pvt->imsi, CONF_SHARED(pvt, group), SMS_RESUME_TAKEOVER);
+		if (!sms) {
+			break;
+		}
+
+		ast_verb (3, "[%s] Resending %u part(s) of SMS message %d\n", PVT_ID(pvt), sms->parts, sms->uid);
+		AST_LIST_INSERT_TAIL (&pvt->sms_spool, sms, entry);
+		pvt->sms_spool_count++;
+	}
+}
+
+/*!
+ * \brief Move spooled SMS messages to at_queue respecting the device smsrate setting
+ * \param pvt -- locked pvt structure
+ * \return milliseconds until next message may be sent, -1 if nothing is waiting
+ */
+#/* */
+EXPORT_DEF int pvt_sms_spool_run(struct pvt *pvt)
+{
+	at_sms_t *sms;
+	int rate = CONF_SHARED(pvt, smsrate);
+
+	while ((sms = AST_LIST_FIRST (&pvt->sms_spool))) {
+		if (!pvt->initialized || !pvt->gsm_registered) {
+			break;
+		}
+		if (rate > 0) {
+			int ms = ast_tvdiff_ms(pvt->sms_spool_next, ast_tvnow());
+			if (ms > 0) {
+				return ms;
+			}
+		}
+
+		AST_LIST_REMOVE_HEAD (&pvt->sms_spool, entry);
+		pvt->sms_spool_count--;
+		if (at_enqueue_sms_prepared(&pvt->sys_chan, sms)) {
+			ast_log (LOG_ERROR, "[%s] Error enqueue spooled SMS message: %s\n", PVT_ID(pvt), error2str(chan_quectel_err));
+		}
+		ast_free(sms);
+
+		if (rate > 0) {
+			pvt->sms_spool_next = ast_tvadd(ast_tvnow(), ast_samp2tv(60, rate));
+		}
+	}
+
+	return -1;
+}
+
+/*!
+ * \brief Wake up running discovery thread for an early pass
+ *
+ * Does not take discovery_lock, so it is safe from monitor threads which
+ * discovery_stop() may wait for while holding the lock.
+ */
+#/* */
+static void discovery_wakeup(public_state_t * state)
+{
+	int fd = state->discovery_wake[1];
+
+	if (state->unloading_flag || fd < 0)
+		return;
+
+	/* pipe is non blocking and full pipe wakes thread as well */
+	if (write(fd, "", 1) < 0 && errno != EAGAIN) {
+		ast_log(LOG_WARNING, "Unable to wake up discovery thread: %s\n", strerror(errno));
+	}
+}
 
 /*!
  * \brief Check if the module is unloading.
@@ -594,16 +1175,26 @@ static void* do_monitor_phone (void* data)
 	at_res_t	at_res;
 	const struct at_queue_cmd * ecmd;
 	int		t;
+	int		spool_t;
 	char buf[2*1024];
 	struct ringbuffer rb;
 	struct iovec	iov[2];
 	int		iovcnt;
+	int		lost = 0;
 	char		dev[sizeof(PVT_ID(pvt))];
 	int 		fd;
 	int		read_result = 0;
+	char*		str;
+	size_t		len;
+	struct timeval	locked;
 
 	pvt->timeout = DATA_READ_TIMEOUT;
-	rb_init (&rb, buf, sizeof (buf));
+
+	/* mirrored buffer keeps every response contiguous, fall back to joining them in scratch */
+	if (rb_init_mirror (&rb, sizeof (buf)))
+	{
+		rb_init (&rb, buf, sizeof (buf));
+	}
 
 	ast_mutex_lock (&pvt->lock);
 
@@ -611,6 +1202,12 @@ static void* do_monitor_phone (void* data)
 	fd = pvt->data_fd;
 	ast_copy_string(dev, PVT_ID(pvt), sizeof(dev));
 
+	pvt->scratch = ast_malloc (PVT_SCRATCH_SIZE);
+	if (!pvt->scratch)
+	{
+		goto e_cleanup;
+	}
+
 	clean_read_data(dev, fd);
 
 	/* schedule quectel initilization  */
@@ -632,8 +1229,10 @@ static void* do_monitor_phone (void* data)
 	while (1)
 	{
 		ast_mutex_lock (&pvt->lock);
+		locked = ast_tvnow();
 
 		handle_expired_reports(pvt);
+		handle_sms_resume(pvt);
 		if (port_status (pvt->data_fd))
 		{
 			ast_log (LOG_ERROR, "[%s] Lost connection to Quectel\n", dev);
@@ -661,14 +1260,26 @@ static void* do_monitor_phone (void* data)
 		if(t < 0)
 			t = pvt->timeout;
 
+		/* wake up in time for next spooled SMS */
+		spool_t = pvt_sms_spool_run(pvt);
+		if(spool_t >= 0 && spool_t < t)
+			t = spool_t;
+		else
+			spool_t = -1;
+
+		hist_add(&PVT_STAT(pvt, lock_hold), ast_tvdiff_us(ast_tvnow(), locked));
 		ast_mutex_unlock (&pvt->lock);
 
 		if (!at_wait (fd, &t))
 		{
+			if(spool_t >= 0)
+				continue;
+
 			ast_mutex_lock (&pvt->lock);
 			ecmd = at_queue_head_cmd (pvt);
 			if(ecmd)
 			{
+				PVT_STAT_ADD(pvt, at_timeouts[ecmd->cmd], 1);
 				ast_log (LOG_ERROR, "[%s] timedout while waiting '%s' in response to '%s'\n", dev, at_res2str (ecmd->res), at_cmd2str (ecmd->cmd));
 				goto e_cleanup;
 			}
@@ -684,23 +1295,42 @@ static void* do_monitor_phone (void* data)
 			break;
 		}
 
-		ast_mutex_lock (&pvt->lock);
-		PVT_STAT(pvt, d_read_bytes) += iovcnt;
-		ast_mutex_unlock (&pvt->lock);
+		PVT_STAT_ADD(pvt, d_read_bytes, iovcnt);
 
 		ast_verb (100, "[%s] at_read_result_iov\n", dev);
 		while ((iovcnt = at_read_result_iov (pvt, &read_result, &rb, iov)) > 0)
 		{
+			len = iov[0].iov_len + iov[1].iov_len;
+			pvt->scratch_used = 0;
+			str = rb_read_contiguous (&rb, len);
+			if (!str)
+			{
+				ast_debug (5, "[%s] iovcnt == 2\n", dev);
+				str = pvt_scratch (pvt, len);
+				if (!str)
+				{
+					/* classification skips response in ring buffer */
+					ast_log (LOG_ERROR, "[%s] Not enough scratch memory, response of %zu bytes dropped\n", dev, len);
+					at_read_result_classification (&rb, len);
+					continue;
+				}
+				memcpy (str, iov[0].iov_base, iov[0].iov_len);
+				memcpy (str + iov[0].iov_len, iov[1].iov_base, iov[1].iov_len);
+			}
+
 			ast_verb (100, "[%s] at_read_result_classification\n", dev);
-			at_res = at_read_result_classification (&rb, iov[0].iov_len + iov[1].iov_len);
+			at_res = at_read_result_classification (&rb, len);
 
 			ast_mutex_lock (&pvt->lock);
-			PVT_STAT(pvt, at_responses) ++;
+			locked = ast_tvnow();
+			PVT_STAT_ADD(pvt, at_responses, 1);
 			ast_verb (100, "[%s] %s: classified\n", dev, __func__);
-			if (at_response (pvt, iov, iovcnt, at_res) || at_queue_run(pvt))
+			if (at_response (pvt, str, len, at_res) || at_queue_run(pvt))
 			{
 				goto e_cleanup;
 			}
+			pvt_status_publish (pvt);
+			hist_add(&PVT_STAT(pvt, lock_hold), ast_tvdiff_us(ast_tvnow(), locked));
 			ast_mutex_unlock (&pvt->lock);
 		}
 	}
@@ -714,13 +1344,21 @@ e_cleanup:
 	}
 	/* it real, unsolicited disconnect */
 	pvt->terminate_monitor = 0;
+	lost = 1;
 
 e_restart:
 	disconnect_quectel (pvt);
 //	pvt->monitor_running = 0;
+	ast_free (pvt->scratch);
+	pvt->scratch = NULL;
 	ast_mutex_unlock (&pvt->lock);
+	rb_fini (&rb);
 
-	/* TODO: wakeup discovery thread after some delay */
+	/* reconnect without waiting for discovery interval, discovery thread delays the pass a little */
+	if (lost)
+	{
+		discovery_wakeup(gpublic);
+	}
 	return NULL;
 }
 
@@ -799,6 +1437,12 @@ static int pvt_discovery(struct pvt * pvt)
 				PVT_STATE(pvt, data_tty),
 				PVT_STATE(pvt, audio_tty)
 				);
+
+			/* [usbports] entry with uac has no voice port, audio goes through sound card */
+			if(PVT_STATE(pvt, audio_tty)[0] == 0 && strcmp(CONF_UNIQ(pvt, quec_uac), "1") != 0) {
+				ast_log (LOG_ERROR, "[%s] Device has no voice port, its USB id is mapped to uac in [usbports], set quec_uac=1\n", PVT_ID(pvt));
+				resolved = 0;
+			}
 		} else {
 			ast_debug(3, "[%s] Not found ports for%s%s%s%s\n",
 				PVT_ID(pvt),
@@ -873,6 +1517,7 @@ static void pvt_start(struct pvt * pvt)
 
 	pvt->connected = 1;
 	pvt->current_state = DEV_STATE_STARTED;
+	pvt_status_publish(pvt);
 	manager_event_device_status(PVT_ID(pvt), "Connect");
 	ast_verb(3, "[%s] Quectel has connected, initializing...\n", PVT_ID(pvt));
 	return;
@@ -886,9 +1531,13 @@ cleanup_datafd:
 #/* */
 static void pvt_free(struct pvt * pvt)
 {
+	pvt_index_del(gpublic, pvt);
 	at_queue_flush(pvt);
+	sms_spool_flush(pvt);
 	if(pvt->dsp)
 		ast_dsp_free(pvt->dsp);
+	mixb_fini(&pvt->a_write_mixb);
+	ast_mutex_destroy(&pvt->a_lock);
 
 	ast_mutex_unlock(&pvt->lock);
 
@@ -904,6 +1553,210 @@ static void pvt_destroy(struct pvt * pvt)
 
 }
 
+#define DISCOVERY_SETTLE_MS	500				/* delay discovery pass after wake up, let udev create the ports */
+
+#ifdef __linux__
+/*!
+ * \brief Open socket for kernel hotplug events
+ * \return socket or -1, discovery falls back to polling
+ */
+#/* */
+static int discovery_uevent_open()
+{
+	struct sockaddr_nl addr;
+	int fd;
+
+	fd = socket(AF_NETLINK, SOCK_DGRAM | SOCK_CLOEXEC | SOCK_NONBLOCK, NETLINK_KOBJECT_UEVENT);
+	if (fd < 0)
+	{
+		return -1;
+	}
+
+	memset(&addr, 0, sizeof(addr));
+	addr.nl_family = AF_NETLINK;
+	addr.nl_groups = 1;
+	if (bind(fd, (struct sockaddr *) &addr, sizeof(addr)) < 0)
+	{
+		close(fd);
+		return -1;
+	}
+	return fd;
+}
+
+/*!
+ * \brief Check if hotplug event adds a port of modem
+ * \param msg -- "add@<devpath>" followed by KEY=value fields, all nul separated
+ * \param len -- length of msg
+ */
+#/* */
+static int discovery_uevent_added(const char * msg, size_t len)
+{
+	const char * end = msg + len;
+	size_t field;
+	int add = 0;
+	int port = 0;
+
+/* whole field equals literal, a field cut at end of message never matches */
+#define UEVENT_FIELD_IS(lit) (field == sizeof(lit) - 1 && !memcmp(msg, lit, field))
+
+	for (; msg < end; msg += field + 1)
+	{
+		field = strnlen(msg, end - msg);
+		if (UEVENT_FIELD_IS("ACTION=add"))
+		{
+			add = 1;
+		}
+		else if (UEVENT_FIELD_IS("SUBSYSTEM=tty") || UEVENT_FIELD_IS("SUBSYSTEM=sound"))
+		{
+			port = 1;
+		}
+	}
+#undef UEVENT_FIELD_IS
+	return add && port;
+}
+#else /* __linux__ */
+#define discovery_uevent_open()		(-1)
+#define discovery_uevent_added(msg, len) 0
+#endif /* __linux__ */
+
+/*!
+ * \brief Create wake up pipe and hotplug socket of discovery thread
+ * \return 0 on success
+ */
+#/* */
+static int discovery_fds_open(public_state_t * state)
+{
+	int i;
+
+	if (pipe(state->discovery_wake) < 0)
+	{
+		state->discovery_wake[0] = state->discovery_wake[1] = -1;
+		return -1;
+	}
+	for (i = 0; i < 2; i++)
+	{
+		fcntl(state->discovery_wake[i], F_SETFL, fcntl(state->discovery_wake[i], F_GETFL) | O_NONBLOCK);
+		fcntl(state->discovery_wake[i], F_SETFD, fcntl(state->discovery_wake[i], F_GETFD) | FD_CLOEXEC);
+	}
+
+	state->discovery_uevent = discovery_uevent_open();
+	if (state->discovery_uevent < 0)
+	{
+		ast_debug(1, "Hotplug events not available, discover devices each %d seconds\n", SCONF_GLOBAL(state, discovery_interval));
+	}
+	return 0;
+}
+
+#/* */
+static void discovery_fds_close(public_state_t * state)
+{
+	if (state->discovery_uevent >= 0)
+	{
+		close(state->discovery_uevent);
+	}
+	if (state->discovery_wake[0] >= 0)
+	{
+		close(state->discovery_wake[0]);
+		close(state->discovery_wake[1]);
+	}
+	state->discovery_uevent = state->discovery_wake[0] = state->discovery_wake[1] = -1;
+}
+
+/*!
+ * \brief Sleep until next discovery pass
+ *
+ * Wakes up on discovery_restart(), on plugged in tty or sound device and at
+ * latest after discovery_interval. Events are followed by a short delay so
+ * a burst of them and udev rules for new ports are handled by one pass.
+ */
+#/* */
+static void discovery_wait(public_state_t * state)
+{
+	struct pollfd fds[2];
+	struct timeval until;
+	struct timeval settle;
+	char buf[2048];
+	ssize_t len;
+	nfds_t nfds = 1;
+	int timeout;
+	int pending = 0;
+
+	until = ast_tvadd(ast_tvnow(), ast_tv(SCONF_GLOBAL(state, discovery_interval), 0));
+
+	fds[0].fd = state->discovery_wake[0];
+	fds[0].events = POLLIN;
+	if (state->discovery_uevent >= 0)
+	{
+		fds[1].fd = state->discovery_uevent;
+		fds[1].events = POLLIN;
+		nfds = 2;
+	}
+
+	while (state->unloading_flag == 0)
+	{
+		timeout = ast_tvdiff_ms(until, ast_tvnow());
+		if (timeout <= 0)
+		{
+			break;
+		}
+		if (poll(fds, nfds, timeout) <= 0)
+		{
+			continue;
+		}
+
+		if (fds[0].revents & POLLIN)
+		{
+			while (read(state->discovery_wake[0], buf, sizeof(buf)) > 0)
+			{
+			}
+			pending = 1;
+		}
+		if (nfds > 1 && (fds[1].revents & POLLIN))
+		{
+			while ((len = recv(state->discovery_uevent, buf, sizeof(buf), MSG_DONTWAIT)) > 0)
+			{
+				if (discovery_uevent_added(buf, len))
+				{
+					pending = 1;
+				}
+			}
+		}
+
+		if (pending == 1)
+		{
+			pending = 2;
+			settle = ast_tvadd(ast_tvnow(), ast_tv(0, DISCOVERY_SETTLE_MS * 1000));
+			if (ast_tvcmp(settle, until) < 0)
+			{
+				until = settle;
+			}
+		}
+	}
+}
+
+#/* check any device going to start looks up its ports by IMEI/IMSI in this pass */
+static int discovery_pending(struct public_state * state)
+{
+	struct pvt * pvt;
+	int pending = 0;
+
+	AST_RWLIST_RDLOCK(&state->devices);
+	AST_RWLIST_TRAVERSE(&state->devices, pvt, entry)
+	{
+		ast_mutex_lock (&pvt->lock);
+		pending = pvt->restart_time == RESTATE_TIME_NOW
+			&& pvt->desired_state != pvt->current_state
+			&& (pvt->desired_state == DEV_STATE_STARTED || pvt->desired_state == DEV_STATE_RESTARTED)
+			&& CONF_UNIQ(pvt, data_tty)[0] == 0 && CONF_UNIQ(pvt, audio_tty)[0] == 0;
+		ast_mutex_unlock (&pvt->lock);
+		if(pending)
+			break;
+	}
+	AST_RWLIST_UNLOCK (&state->devices);
+
+	return pending;
+}
+
 static void * do_discovery(void * arg)
 {
 	struct public_state * state = (struct public_state *) arg;
@@ -911,6 +1764,12 @@ static void * do_discovery(void * arg)
 
 	while(state->unloading_flag == 0)
 	{
+		/* IMEI/IMSI of all ports queried once per pass, pvt_discovery() only reads results */
+		if(discovery_pending(state))
+		{
+			pdiscovery_refresh();
+		}
+
 		/* read lock for avoid deadlock when IMEI/IMSI discovery */
 		AST_RWLIST_RDLOCK(&state->devices);
 		AST_RWLIST_TRAVERSE(&state->devices, pvt, entry)
@@ -937,6 +1796,7 @@ static void * do_discovery(void * arg)
 						pvt_stop(pvt);
 				}
 			}
+			pvt_status_publish(pvt);
 			ast_mutex_unlock (&pvt->lock);
 		}
 		AST_RWLIST_UNLOCK (&state->devices);
@@ -956,11 +1816,7 @@ static void * do_discovery(void * arg)
 		AST_RWLIST_TRAVERSE_SAFE_END;
 		AST_RWLIST_UNLOCK(&state->devices);
 
-		/* Go to sleep (only if we are not unloading) */
-		if (state->unloading_flag == 0)
-		{
-			sleep(SCONF_GLOBAL(state, discovery_interval));
-		}
+		discovery_wait(state);
 	}
 
 	return NULL;
@@ -969,7 +1825,7 @@ static void * do_discovery(void * arg)
 #/* */
 static int discovery_restart(public_state_t * state)
 {
-	if(state->discovery_thread == AST_PTHREADT_STOP)
+	if(state->unloading_flag || state->discovery_thread == AST_PTHREADT_STOP)
 		return 0;
 
 	ast_mutex_lock(&state->discovery_lock);
@@ -979,8 +1835,7 @@ static int discovery_restart(public_state_t * state)
 		return -1;
 	}
 	if (state->discovery_thread != AST_PTHREADT_NULL) {
-		/* Wake up the thread */
-		pthread_kill(state->discovery_thread, SIGURG);
+		discovery_wakeup(state);
 	} else {
 		/* Start a new monitor */
 		if (ast_pthread_create_background(&state->discovery_thread, NULL, do_discovery, state) < 0) {
@@ -1002,7 +1857,9 @@ static void discovery_stop(public_state_t * state)
 	ast_mutex_lock(&state->discovery_lock);
 	if (state->discovery_thread && (state->discovery_thread != AST_PTHREADT_STOP) && (state->discovery_thread != AST_PTHREADT_NULL)) {
 //		pthread_cancel(state->discovery_thread);
-		pthread_kill(state->discovery_thread, SIGURG);
+		if (write(state->discovery_wake[1], "", 1) < 0 && errno != EAGAIN) {
+			pthread_kill(state->discovery_thread, SIGURG);
+		}
 		pthread_join(state->discovery_thread, NULL);
 	}
 
@@ -1013,8 +1870,10 @@ static void discovery_stop(public_state_t * state)
 #/* */
 EXPORT_DEF void pvt_on_create_1st_channel(struct pvt* pvt)
 {
+	ast_mutex_lock (&pvt->a_lock);
         if (strcmp(CONF_UNIQ(pvt, quec_uac),"1") != 0) {
-	mixb_init (&pvt->a_write_mixb, pvt->a_write_buf, sizeof (pvt->a_write_buf));
+	if (mixb_init_mirror (&pvt->a_write_mixb, sizeof (pvt->a_write_buf)))
+		mixb_init (&pvt->a_write_mixb, pvt->a_write_buf, sizeof (pvt->a_write_buf));
 //	rb_init (&pvt->a_write_rb, pvt->a_write_buf, sizeof (pvt->a_write_buf));
 
 	if(!pvt->a_timer)
@@ -1029,6 +1888,7 @@ EXPORT_DEF void pvt_on_create_1st_channel(struct pvt* pvt)
 	pvt->dtmf_begin_time.tv_usec = 0;
 	pvt->dtmf_end_time.tv_sec = 0;
 	pvt->dtmf_end_time.tv_usec = 0;
+	ast_mutex_unlock (&pvt->a_lock);
 
 	manager_event_device_status(PVT_ID(pvt), "Used");
 }
@@ -1036,11 +1896,13 @@ EXPORT_DEF void pvt_on_create_1st_channel(struct pvt* pvt)
 #/* */
 EXPORT_DEF void pvt_on_remove_last_channel(struct pvt* pvt)
 {
+	ast_mutex_lock (&pvt->a_lock);
 	if (pvt->a_timer)
 	{
 		ast_timer_close(pvt->a_timer);
 		pvt->a_timer = NULL;
 	}
+	ast_mutex_unlock (&pvt->a_lock);
 	manager_event_device_status(PVT_ID(pvt), "Free");
 }
 
@@ -1156,20 +2018,51 @@ static int can_dial(struct pvt* pvt, int opts, const struct ast_channel * reques
 	return ready4voice_call(pvt, NULL, opts);
 }
 
+#/* check device is selected by resource spec of find_device_by_resource_ex() */
+static int match_resource(const char * resource, const char * id, int group, const char * provider_name, const char * imsi, const char * imei)
+{
+	if (((resource[0] == 'g') || (resource[0] == 'G') || (resource[0] == 'r') || (resource[0] == 'R'))
+		&& ((resource[1] >= '0') && (resource[1] <= '9')))
+	{
+		return group == (int) strtol (&resource[1], (char**) NULL, 10);
+	}
+	else if (((resource[0] == 'p') || (resource[0] == 'P')) && resource[1] == ':')
+	{
+		return !strcmp (provider_name, &resource[2]);
+	}
+	else if (((resource[0] == 's') || (resource[0] == 'S')) && resource[1] == ':')
+	{
+		return !strncmp (imsi, &resource[2], strlen (&resource[2]));
+	}
+	else if (((resource[0] == 'i') || (resource[0] == 'I')) && resource[1] == ':')
+	{
+		return !strcmp (imei, &resource[2]);
+	}
+	return !strcmp (id, resource);
+}
+
+#/* check pvt is selected by resource spec of find_device_by_resource_ex(); pvt must be locked */
+EXPORT_DEF int pvt_match_resource(const struct pvt * pvt, const char * resource)
+{
+	return match_resource(resource, PVT_ID(pvt), CONF_SHARED(pvt, group), pvt->provider_name, pvt->imsi, pvt->imei);
+}
+
+#/* same as pvt_match_resource() for published status of unlocked pvt */
+static int status_match_resource(const struct pvt * pvt, const struct pvt_status * status, const char * resource)
+{
+	return match_resource(resource, PVT_ID(pvt), status->group, status->provider_name, status->imsi, status->imei);
+}
+
 #/* return locked pvt or NULL */
 EXPORT_DEF struct pvt * find_device_ex(struct public_state * state, const char * name)
 {
 	struct pvt * pvt;
 
 	AST_RWLIST_RDLOCK(&state->devices);
-	AST_RWLIST_TRAVERSE(&state->devices, pvt, entry)
+	pvt = pvt_index_find(state, PVT_INDEX_ID, name);
+	if (pvt)
 	{
 		ast_mutex_lock (&pvt->lock);
-		if (!strcmp (PVT_ID(pvt), name))
-		{
-			break;
-		}
-		ast_mutex_unlock (&pvt->lock);
 	}
 	AST_RWLIST_UNLOCK(&state->devices);
 
@@ -1193,236 +2086,302 @@ EXPORT_DEF struct pvt * find_device_ext (const char * name)
 	return pvt;
 }
 
+#/* lock device from index if it still matches resource and can dial; devices list must be locked */
+static struct pvt * find_indexed_for_dial(struct public_state * state, pvt_index_t which, const char * key, const char * resource, int opts, const struct ast_channel * requestor, int * exists)
+{
+	struct pvt * pvt = pvt_index_find(state, which, key);
+	struct pvt_status status;
+
+	if (!pvt)
+	{
+		return NULL;
+	}
+
+	*exists = 1;
+	/* do not wait for device which can't be selected */
+	pvt_status_get(pvt, &status);
+	if (!status.ready4voice)
+	{
+		return NULL;
+	}
+
+	ast_mutex_lock (&pvt->lock);
+	if (pvt_match_resource(pvt, resource) && can_dial(pvt, opts, requestor))
+	{
+		return pvt;
+	}
+	ast_mutex_unlock (&pvt->lock);
+	return NULL;
+}
+
+/*!
+ * \brief Lock first device which can dial
+ * \param pvts -- candidates
+ * \param count -- number of candidates
+ * \param resource -- resource spec candidates must still match
+ * \param cursor -- round robin cursor to start at and update, NULL for start at first
+ * \return locked pvt or NULL
+ */
+static struct pvt * select_for_dial(struct pvt * const * pvts, unsigned count, const char * resource, int opts, const struct ast_channel * requestor, int * exists, unsigned int * cursor)
+{
+	unsigned i;
+	unsigned start = cursor ? __atomic_load_n(cursor, __ATOMIC_RELAXED) : 0;
+	struct pvt * pvt;
+	struct pvt_status status;
+
+	for (i = 0; i < count; i++)
+	{
+		pvt = pvts[(start + i) % count];
+		*exists = 1;
+
+		/* do not wait for devices which can't be selected */
+		pvt_status_get(pvt, &status);
+		if (!status.ready4voice)
+		{
+			continue;
+		}
+
+		ast_mutex_lock (&pvt->lock);
+		if (pvt_match_resource(pvt, resource) && can_dial(pvt, opts, requestor))
+		{
+			if (cursor)
+			{
+				__atomic_store_n(cursor, (start + i + 1) % count, __ATOMIC_RELAXED);
+			}
+			return pvt;
+		}
+		ast_mutex_unlock (&pvt->lock);
+	}
+	return NULL;
+}
+
 #/* like find_device but for resource spec; return locked! pvt or NULL */
 EXPORT_DEF struct pvt * find_device_by_resource_ex(struct public_state * state, const char * resource, int opts, const struct ast_channel * requestor, int * exists)
 {
 	int group;
-	size_t i;
-	size_t j;
-	size_t c;
-	size_t last_used;
+	unsigned count = 0;
+	unsigned size = 0;
+	unsigned int * cursor = NULL;
 	struct pvt * pvt;
+	struct pvt ** pvts = NULL;
 	struct pvt * found = NULL;
-	struct pvt * round_robin[MAXQUECTELDEVICES];
+	struct pvt_status status;
 
 	*exists = 0;
 	/* Find requested device and make sure it's connected and initialized. */
 	AST_RWLIST_RDLOCK(&state->devices);
 
-	if (((resource[0] == 'g') || (resource[0] == 'G')) && ((resource[1] >= '0') && (resource[1] <= '9')))
+	if (((resource[0] == 'g') || (resource[0] == 'G') || (resource[0] == 'r') || (resource[0] == 'R'))
+		&& ((resource[1] >= '0') && (resource[1] <= '9')))
 	{
 		errno = 0;
 		group = (int) strtol (&resource[1], (char**) NULL, 10);
 		if (errno != EINVAL)
 		{
-			AST_RWLIST_TRAVERSE(&state->devices, pvt, entry)
-			{
-				ast_mutex_lock (&pvt->lock);
-
-				if (CONF_SHARED(pvt, group) == group)
-				{
-					*exists = 1;
-					if(can_dial(pvt, opts, requestor))
-					{
-						found = pvt;
-						break;
-					}
-				}
-				ast_mutex_unlock (&pvt->lock);
-			}
+			/* g<N> takes first available device, r<N> round robin */
+			pvts = pvt_members_get(state, &state->groups, group, "", &count, &cursor);
+			found = select_for_dial(pvts, count, resource, opts, requestor, exists, (resource[0] == 'r' || resource[0] == 'R') ? cursor : NULL);
 		}
 	}
-	else if (((resource[0] == 'r') || (resource[0] == 'R')) && ((resource[1] >= '0') && (resource[1] <= '9')))
+	else if (((resource[0] == 'p') || (resource[0] == 'P')) && resource[1] == ':')
 	{
-		errno = 0;
-		group = (int) strtol (&resource[1], (char**) NULL, 10);
-		if (errno != EINVAL)
+		pvts = pvt_members_get(state, &state->providers, 0, &resource[2], &count, &cursor);
+		found = select_for_dial(pvts, count, resource, opts, requestor, exists, cursor);
+	}
+	else if (((resource[0] == 's') || (resource[0] == 'S')) && resource[1] == ':' && strlen (&resource[2]) == IMSI_SIZE)
+	{
+		/* full IMSI selects single device */
+		found = find_indexed_for_dial(state, PVT_INDEX_IMSI, &resource[2], resource, opts, requestor, exists);
+	}
+	else if (((resource[0] == 's') || (resource[0] == 'S')) && resource[1] == ':')
+	{
+		/* IMSI prefix, generate a list of matched devices */
+		AST_RWLIST_TRAVERSE(&state->devices, pvt, entry)
 		{
-			/* Generate a list of all available devices */
-			j = ITEMS_OF (round_robin);
-			c = 0; last_used = 0;
-			AST_RWLIST_TRAVERSE(&state->devices, pvt, entry)
+			pvt_status_get(pvt, &status);
+			if (status_match_resource(pvt, &status, resource) && pvt_array_push(&pvts, &count, &size, pvt))
 			{
-				ast_mutex_lock (&pvt->lock);
-				if (CONF_SHARED(pvt, group) == group)
-				{
-					round_robin[c] = pvt;
-					if (pvt->group_last_used == 1)
-					{
-						pvt->group_last_used = 0;
-						last_used = c;
-					}
-
-					c++;
-
-					if (c == j)
-					{
-						ast_mutex_unlock (&pvt->lock);
-						break;
-					}
-				}
-				ast_mutex_unlock (&pvt->lock);
-			}
-
-			/* Search for a available device starting at the last used device */
-			for (i = 0, j = last_used + 1; i < c; i++, j++)
-			{
-				if (j == c)
-				{
-					j = 0;
-				}
-
-				pvt = round_robin[j];
-				*exists = 1;
-
-				ast_mutex_lock (&pvt->lock);
-				if (can_dial(pvt, opts, requestor))
-				{
-					pvt->group_last_used = 1;
-					found = pvt;
-					break;
-				}
-				ast_mutex_unlock (&pvt->lock);
+				break;
 			}
 		}
+		found = select_for_dial(pvts, count, resource, opts, requestor, exists, &state->sim_cursor);
 	}
-	else if (((resource[0] == 'p') || (resource[0] == 'P')) && resource[1] == ':')
+	else if (((resource[0] == 'i') || (resource[0] == 'I')) && resource[1] == ':')
 	{
-		/* Generate a list of all available devices */
-		j = ITEMS_OF(round_robin);
-		c = 0; last_used = 0;
-		AST_RWLIST_TRAVERSE(&state->devices, pvt, entry)
-		{
-			ast_mutex_lock (&pvt->lock);
-			if (!strcmp (pvt->provider_name, &resource[2]))
-			{
-				round_robin[c] = pvt;
-				if (pvt->prov_last_used == 1)
-				{
-					pvt->prov_last_used = 0;
-					last_used = c;
-				}
+		found = find_indexed_for_dial(state, PVT_INDEX_IMEI, &resource[2], resource, opts, requestor, exists);
+	}
+	else
+	{
+		found = find_indexed_for_dial(state, PVT_INDEX_ID, resource, resource, opts, requestor, exists);
+	}
 
-				c++;
+	AST_RWLIST_UNLOCK(&state->devices);
+	ast_free(pvts);
+	return found;
+}
 
-				if (c == j)
-				{
-					ast_mutex_unlock (&pvt->lock);
-					break;
-				}
-			}
-			ast_mutex_unlock (&pvt->lock);
-		}
+#/* */
+EXPORT_DEF int ready4sms(const struct pvt * pvt)
+{
+	return pvt->connected
+		&& pvt->initialized
+		&& pvt->has_sms
+		&& pvt->gsm_registered
+		&& pvt_enabled(pvt);
+}
 
-		/* Search for a available device starting at the last used device */
-		for (i = 0, j = last_used + 1; i < c; i++, j++)
-		{
-			if (j == c)
-			{
-				j = 0;
-			}
+#/* number of AT commands and spooled SMS waiting on device */
+EXPORT_DEF unsigned pvt_sms_backlog(const struct pvt * pvt)
+{
+	return PVT_STATE(pvt, at_cmds) + pvt->sms_spool_count;
+}
 
-			pvt = round_robin[j];
-			*exists = 1;
+/* how good device is for next SMS, compared in order of fields */
+struct sms_choice
+{
+	unsigned	backlog;			/*!< less is better */
+	int		home;				/*!< registered in home network */
+	int		rssi;				/*!< -1 if unknown */
+};
 
-			ast_mutex_lock (&pvt->lock);
-			if (can_dial(pvt, opts, requestor))
-			{
-				pvt->prov_last_used = 1;
-				found = pvt;
-				break;
-			}
-			ast_mutex_unlock (&pvt->lock);
-		}
-	}
-	else if (((resource[0] == 's') || (resource[0] == 'S')) && resource[1] == ':')
-	{
-		/* Generate a list of all available devices */
-		j = ITEMS_OF(round_robin);
-		c = 0; last_used = 0;
-		i = strlen (&resource[2]);
+#/* fill choice from locked pvt */
+static void sms_choice_fill(struct sms_choice * choice, const struct pvt * pvt)
+{
+	choice->backlog = pvt_sms_backlog(pvt);
+	choice->home = pvt->gsm_reg_status == 1;
+	choice->rssi = pvt->rssi == 99 ? -1 : pvt->rssi;
+}
 
-		AST_RWLIST_TRAVERSE(&state->devices, pvt, entry)
-		{
-			ast_mutex_lock (&pvt->lock);
-			if (!strncmp (pvt->imsi, &resource[2], i))
-			{
-				round_robin[c] = pvt;
-				if (pvt->sim_last_used == 1)
-				{
-					pvt->sim_last_used = 0;
-					last_used = c;
-				}
+#/* */
+static int sms_choice_better(const struct sms_choice * a, const struct sms_choice * b)
+{
+	if (a->backlog != b->backlog)
+		return a->backlog < b->backlog;
+	if (a->home != b->home)
+		return a->home;
+	return a->rssi > b->rssi;
+}
 
-				c++;
+#/* lock device from index if it still matches resource and is ready for SMS, set chan_quectel_err otherwise */
+static struct pvt * find_indexed_for_sms(struct public_state * state, pvt_index_t which, const char * key, const char * resource)
+{
+	struct pvt * pvt;
 
-				if (c == j)
-				{
-					ast_mutex_unlock (&pvt->lock);
-					break;
-				}
-			}
-			ast_mutex_unlock (&pvt->lock);
+	AST_RWLIST_RDLOCK(&state->devices);
+	pvt = pvt_index_find(state, which, key);
+	if (pvt)
+	{
+		ast_mutex_lock (&pvt->lock);
+		if (!pvt_match_resource(pvt, resource))
+		{
+			chan_quectel_err = E_DEVICE_NOT_FOUND;
 		}
-
-		/* Search for a available device starting at the last used device */
-		for (i = 0, j = last_used + 1; i < c; i++, j++)
+		else if (!pvt_enabled(pvt))
 		{
-			if (j == c)
-			{
-				j = 0;
-			}
+			chan_quectel_err = E_DEVICE_DISABLED;
+		}
+		else if (!ready4sms(pvt))
+		{
+			chan_quectel_err = E_DEVICE_DISCONNECTED;
+		}
+		else
+		{
+			AST_RWLIST_UNLOCK(&state->devices);
+			return pvt;
+		}
+		ast_mutex_unlock (&pvt->lock);
+		pvt = NULL;
+	}
+	else
+	{
+		chan_quectel_err = E_DEVICE_NOT_FOUND;
+	}
+	AST_RWLIST_UNLOCK(&state->devices);
+	return pvt;
+}
 
-			pvt = round_robin[j];
-			*exists = 1;
+/*!
+ * \brief Select device for outgoing SMS
+ * \param state -- public state
+ * \param resource -- device name or resource spec as for Dial(): g<N>, r<N>, p:<provider>, s:<imsi prefix>, i:<imei>
+ * \return locked pvt ready for SMS with smallest backlog or NULL and chan_quectel_err set
+ * \note device name, full IMSI and IMEI are looked up by index, only the other specs walk devices list
+ */
+#/* */
+EXPORT_DEF struct pvt * find_device_for_sms_ex(struct public_state * state, const char * resource)
+{
+	struct pvt * pvt;
+	struct pvt * best = NULL;
+	struct sms_choice best_choice;
+	struct sms_choice choice;
+	struct pvt_status status;
+	int exists = 0;
 
-			ast_mutex_lock (&pvt->lock);
-			if (can_dial(pvt, opts, requestor))
-			{
-				pvt->sim_last_used = 1;
-				found = pvt;
-				break;
-			}
-			ast_mutex_unlock (&pvt->lock);
+	if (((resource[0] == 's') || (resource[0] == 'S')) && resource[1] == ':')
+	{
+		if (strlen (&resource[2]) == IMSI_SIZE)
+		{
+			return find_indexed_for_sms(state, PVT_INDEX_IMSI, &resource[2], resource);
 		}
 	}
 	else if (((resource[0] == 'i') || (resource[0] == 'I')) && resource[1] == ':')
 	{
-		AST_RWLIST_TRAVERSE(&state->devices, pvt, entry)
+		return find_indexed_for_sms(state, PVT_INDEX_IMEI, &resource[2], resource);
+	}
+	else if (!(((resource[0] == 'g') || (resource[0] == 'G') || (resource[0] == 'r') || (resource[0] == 'R'))
+			&& ((resource[1] >= '0') && (resource[1] <= '9')))
+		&& !(((resource[0] == 'p') || (resource[0] == 'P')) && resource[1] == ':'))
+	{
+		return find_indexed_for_sms(state, PVT_INDEX_ID, resource, resource);
+	}
+
+	AST_RWLIST_RDLOCK(&state->devices);
+	AST_RWLIST_TRAVERSE(&state->devices, pvt, entry)
+	{
+		pvt_status_get(pvt, &status);
+		if (!status_match_resource(pvt, &status, resource))
 		{
-			ast_mutex_lock (&pvt->lock);
-			if (!strcmp(pvt->imei, &resource[2]))
+			continue;
+		}
+		exists = 1;
+		if (!status.ready4sms)
+		{
+			continue;
+		}
+
+		ast_mutex_lock (&pvt->lock);
+		if (pvt_match_resource(pvt, resource))
+		{
+			if (ready4sms(pvt))
 			{
-				*exists = 1;
-				if(can_dial(pvt, opts, requestor))
+				sms_choice_fill(&choice, pvt);
+				if (!best || sms_choice_better(&choice, &best_choice))
 				{
-					found = pvt;
-					break;
+					best = pvt;
+					best_choice = choice;
 				}
 			}
-			ast_mutex_unlock (&pvt->lock);
 		}
+		ast_mutex_unlock (&pvt->lock);
 	}
-	else
+
+	if (best)
 	{
-		AST_RWLIST_TRAVERSE(&state->devices, pvt, entry)
+		/* devices list still locked, so best can't be freed */
+		ast_mutex_lock (&best->lock);
+		if (!ready4sms(best))
 		{
-			ast_mutex_lock (&pvt->lock);
-			if (!strcmp (PVT_ID(pvt), resource))
-			{
-				*exists = 1;
-				if(can_dial(pvt, opts, requestor))
-				{
-					found = pvt;
-					break;
-				}
-			}
-			ast_mutex_unlock (&pvt->lock);
+			ast_mutex_unlock (&best->lock);
+			best = NULL;
 		}
 	}
-
 	AST_RWLIST_UNLOCK(&state->devices);
-	return found;
+
+	if (!best)
+	{
+		chan_quectel_err = exists ? E_DEVICE_DISCONNECTED : E_DEVICE_NOT_FOUND;
+	}
+	return best;
 }
 
 #/* */
@@ -1620,6 +2579,7 @@ EXPORT_DEF char* rssi2dBm(int rssi, char * buf, unsigned len)
 #/* */
 EXPORT_DEF void pvt_dsp_setup(struct pvt * pvt, const char * id, dc_dtmf_setting_t dtmf_new)
 {
+	ast_mutex_lock (&pvt->a_lock);
 	/* first remove dsp if off or changed */
 	if(dtmf_new != CONF_SHARED(pvt, dtmf))
 	{
@@ -1649,6 +2609,7 @@ EXPORT_DEF void pvt_dsp_setup(struct pvt * pvt, const char * id, dc_dtmf_setting
 		}
 	}
 	pvt->real_dtmf = dtmf_new;
+	ast_mutex_unlock (&pvt->a_lock);
 }
 
 static struct pvt * pvt_create(const pvt_config_t * settings)
@@ -1657,8 +2618,10 @@ static struct pvt * pvt_create(const pvt_config_t * settings)
 	if(pvt)
 	{
 		ast_mutex_init (&pvt->lock);
+		ast_mutex_init (&pvt->a_lock);
 
 		AST_LIST_HEAD_INIT_NOLOCK (&pvt->at_queue);
+		AST_LIST_HEAD_INIT_NOLOCK (&pvt->sms_spool);
 		AST_LIST_HEAD_INIT_NOLOCK (&pvt->chans);
 		pvt->sys_chan.pvt = pvt;
 		pvt->sys_chan.state = CALL_STATE_RELEASED;
@@ -1683,6 +2646,7 @@ static struct pvt * pvt_create(const pvt_config_t * settings)
 
 		/* and copy settings */
 		memcpy(&pvt->settings, settings, sizeof(pvt->settings));
+		pvt_status_publish(pvt);
 		return pvt;
 	}
 	else
@@ -1709,14 +2673,88 @@ EXPORT_DEF void pvt_try_restate(struct pvt * pvt)
 	if(pvt_time4restate(pvt))
 	{
 		pvt->restart_time = RESTATE_TIME_NOW;
-		discovery_restart(gpublic);
+		/* may run in monitor thread, see discovery_wakeup() */
+		discovery_wakeup(gpublic);
 	}
+	pvt_status_publish(pvt);
+}
+
+/* how change of setting is applied by pvt_reconfigure() */
+#define RECONF_HOT		0x01		/* copied, used on next access */
+#define RECONF_DSP		0x02		/* DTMF detector rebuilt */
+#define RECONF_RESTART		0x04		/* device restarted, setting is used at start only */
+
+/*!
+ * \brief Compare settings field by field
+ * \param id -- device name for debug
+ * \param old -- current settings
+ * \param new -- settings from config
+ * \return RECONF_* of changed settings, 0 if nothing changed
+ * \note keep in sync with struct dc_uconfig and struct dc_sconfig
+ */
+#/* */
+static unsigned pvt_config_diff(const char * id, const pvt_config_t * old, const pvt_config_t * new)
+{
+	unsigned changes = 0;
+
+#define RECONF_CMP(changed, name, action)							\
+	if (changed)										\
+	{											\
+		ast_debug(2, "[%s] setting %s changed%s\n", id, name,				\
+			(action) == RECONF_RESTART ? ", restart required" : "");		\
+		changes |= (action);								\
+	}
+#define RECONF_USTR(name, action)	RECONF_CMP(strcmp(UCONFIG(old, name), UCONFIG(new, name)), #name, action)
+#define RECONF_SSTR(name, action)	RECONF_CMP(strcmp(SCONFIG(old, name), SCONFIG(new, name)), #name, action)
+#define RECONF_SVAL(name, action)	RECONF_CMP(SCONFIG(old, name) != SCONFIG(new, name), #name, action)
+
+	/* unique, id is key of device */
+	RECONF_USTR(audio_tty, RECONF_RESTART)
+	RECONF_USTR(data_tty, RECONF_RESTART)
+	RECONF_USTR(imei, RECONF_RESTART)
+	RECONF_USTR(imsi, RECONF_RESTART)
+	RECONF_USTR(quec_uac, RECONF_RESTART)
+	RECONF_USTR(alsadev, RECONF_RESTART)
+	RECONF_USTR(mms_pdp, RECONF_RESTART)
+
+	/* shared, sent to modem at initialization */
+	RECONF_SVAL(u2diag, RECONF_RESTART)
+	RECONF_SVAL(resetquectel, RECONF_RESTART)
+	RECONF_SVAL(callwaiting, RECONF_RESTART)
+
+	/* shared, used by channels and handlers; group is rejoined by pvt_status_publish() */
+	RECONF_SSTR(context, RECONF_HOT)
+	RECONF_SSTR(exten, RECONF_HOT)
+	RECONF_SSTR(language, RECONF_HOT)
+	RECONF_SVAL(group, RECONF_HOT)
+	RECONF_SVAL(rxgain, RECONF_HOT)
+	RECONF_SVAL(txgain, RECONF_HOT)
+	RECONF_SVAL(callingpres, RECONF_HOT)
+	RECONF_SVAL(usecallingpres, RECONF_HOT)
+	RECONF_SVAL(autodeletesms, RECONF_HOT)
+	RECONF_SVAL(disablesms, RECONF_HOT)
+	RECONF_SVAL(initstate, RECONF_HOT)
+	RECONF_SVAL(dtmf, RECONF_DSP)
+	RECONF_SVAL(mindtmfgap, RECONF_HOT)
+	RECONF_SVAL(mindtmfduration, RECONF_HOT)
+	RECONF_SVAL(mindtmfinterval, RECONF_HOT)
+	RECONF_SVAL(smsrate, RECONF_HOT)
+	RECONF_SVAL(smsretries, RECONF_HOT)
+	RECONF_SVAL(smsretrydelay, RECONF_HOT)
+
+#undef RECONF_SVAL
+#undef RECONF_SSTR
+#undef RECONF_USTR
+#undef RECONF_CMP
+
+	return changes;
 }
 
 #/* assume caller hold lock */
 static int pvt_reconfigure(struct pvt * pvt, const pvt_config_t * settings, restate_time_t when)
 {
 	int rv = 0;
+	unsigned changes;
 
 	if(SCONFIG(settings, initstate) == DEV_STATE_REMOVED)
 	{
@@ -1725,6 +2763,8 @@ static int pvt_reconfigure(struct pvt * pvt, const pvt_config_t * settings, rest
 	}
 	else
 	{
+		changes = pvt_config_diff(PVT_ID(pvt), &pvt->settings, settings);
+
 		/* check what changes require starting or stopping */
 		if(pvt->desired_state != SCONFIG(settings, initstate)) {
 			pvt->desired_state = SCONFIG(settings, initstate);
@@ -1734,25 +2774,29 @@ static int pvt_reconfigure(struct pvt * pvt, const pvt_config_t * settings, rest
 		}
 
 		/* check what config changes require restaring */
-		else if(strcmp(UCONFIG(settings, audio_tty), CONF_UNIQ(pvt, audio_tty))
-			|| strcmp(UCONFIG(settings, data_tty), CONF_UNIQ(pvt, data_tty))
-			|| strcmp(UCONFIG(settings, imei), CONF_UNIQ(pvt, imei))
-			|| strcmp(UCONFIG(settings, imsi), CONF_UNIQ(pvt, imsi))
-			|| SCONFIG(settings, u2diag) != CONF_SHARED(pvt, u2diag)
-			|| SCONFIG(settings, resetquectel) != CONF_SHARED(pvt, resetquectel)
-			|| SCONFIG(settings, callwaiting) != CONF_SHARED(pvt, callwaiting))
+		else if(changes & RECONF_RESTART)
 		{
-			/* TODO: schedule restart */
 			pvt->desired_state = DEV_STATE_RESTARTED;
 
 			rv = pvt_time4restate(pvt);
 			pvt->restart_time = rv ? RESTATE_TIME_NOW : when;
 		}
 
-		pvt_dsp_setup(pvt, UCONFIG(settings, id), SCONFIG(settings, dtmf));
+		/* unchanged device is not touched at all */
+		if(changes)
+		{
+			/* DTMF detector is rebuilt only when mode changed, detection state of active call kept otherwise */
+			if(changes & RECONF_DSP)
+			{
+				pvt_dsp_setup(pvt, UCONFIG(settings, id), SCONFIG(settings, dtmf));
+			}
 
-		/* and copy settings */
-		memcpy(&pvt->settings, settings, sizeof(pvt->settings));
+			/* and copy settings, audio path reads gains and DTMF settings under a_lock only */
+			ast_mutex_lock (&pvt->a_lock);
+			memcpy(&pvt->settings, settings, sizeof(pvt->settings));
+			ast_mutex_unlock (&pvt->a_lock);
+			pvt_status_publish(pvt);
+		}
 	}
 	return rv;
 }
@@ -1781,6 +2825,9 @@ static int reload_config(public_state_t * state, int recofigure, restate_time_t
 	dc_sconfig_fill_defaults(&config_defaults);
 	dc_sconfig_fill(cfg, "defaults", &config_defaults);
 
+	/* read USB port map for discovery */
+	pdiscovery_config(cfg, "usbports");
+
 	/* FIXME: deadlock avoid ? */
 	AST_RWLIST_RDLOCK(&state->devices);
 	AST_RWLIST_TRAVERSE(&state->devices, pvt, entry)
@@ -1794,7 +2841,7 @@ static int reload_config(public_state_t * state, int recofigure, restate_time_t
 	/* now load devices */
 	for (cat = ast_category_browse (cfg, NULL); cat; cat = ast_category_browse (cfg, cat))
 	{
-		if (strcasecmp (cat, "general") && strcasecmp (cat, "defaults"))
+		if (strcasecmp (cat, "general") && strcasecmp (cat, "defaults") && strcasecmp (cat, "usbports"))
 		{
 			err = dc_config_fill(cfg, cat, &config_defaults, &settings);
 			if(!err)
@@ -1828,6 +2875,8 @@ static int reload_config(public_state_t * state, int recofigure, restate_time_t
 							/* FIXME: deadlock avoid ? */
 							AST_RWLIST_WRLOCK(&state->devices);
 							AST_RWLIST_INSERT_TAIL(&state->devices, pvt, entry);
+							pvt_index_set(state, pvt, PVT_INDEX_ID, PVT_ID(pvt));
+							pvt_members_update(state, pvt, CONF_SHARED(pvt, group), pvt->provider_name);
 							AST_RWLIST_UNLOCK(&state->devices);
 							reload_now++;
 
@@ -1856,6 +2905,7 @@ static int reload_config(public_state_t * state, int recofigure, restate_time_t
 			}
 			else
 				pvt->restart_time = when;
+			pvt_status_publish(pvt);
 		}
 		ast_mutex_unlock(&pvt->lock);
 	}
@@ -1909,13 +2959,17 @@ static int public_state_init(struct public_state * state)
 
 	AST_RWLIST_HEAD_INIT(&state->devices);
 	ast_mutex_init(&state->discovery_lock);
+	ast_rwlock_init(&state->index_lock);
 
 	state->discovery_thread = AST_PTHREADT_NULL;
+	state->discovery_uevent = state->discovery_wake[0] = state->discovery_wake[1] = -1;
 
 	if(reload_config(state, 0, RESTATE_TIME_NOW, NULL) == 0)
 	{
 		rv = AST_MODULE_LOAD_FAILURE;
-		if(discovery_restart(state) == 0)
+		/* before discovery, it reads IMEI/IMSI stored by previous run */
+		smsdb_init();
+		if(discovery_fds_open(state) == 0 && discovery_restart(state) == 0)
 		{
 
 			/* set preferred capabilities */
@@ -1942,11 +2996,11 @@ static int public_state_init(struct public_state * state)
 			/* register our channel type */
 			if(ast_channel_register(&channel_tech) == 0)
 			{
-				smsdb_init();
 				cli_register();
 
 				app_register();
 				manager_register();
+				metrics_register();
 
 				return AST_MODULE_LOAD_SUCCESS;
 			}
@@ -1966,13 +3020,18 @@ static int public_state_init(struct public_state * state)
 		{
 			ast_log (LOG_ERROR, "Unable to create discovery thread\n");
 		}
+		discovery_fds_close(state);
 		devices_destroy(state);
+		pvt_members_free(&state->groups);
+		pvt_members_free(&state->providers);
+		smsdb_atexit();
 	}
 	else
 	{
 		ast_log (LOG_ERROR, "Errors reading config file " CONFIG_FILE ", Not loading module\n");
 	}
 
+	ast_rwlock_destroy(&state->index_lock);
 	ast_mutex_destroy(&state->discovery_lock);
 	AST_RWLIST_HEAD_DESTROY(&state->devices);
 
@@ -1991,7 +3050,9 @@ static void public_state_fini(struct public_state * state)
 	channel_tech.capabilities = ast_format_cap_destroy(channel_tech.capabilities);
 #endif /* ^10-13 */
 
-	/* Unregister the CLI & APP & MANAGER */
+	/* Unregister the CLI & APP & MANAGER & HTTP */
+
+	metrics_unregister();
 
 	manager_unregister();
 
@@ -2000,8 +3061,12 @@ static void public_state_fini(struct public_state * state)
 	cli_unregister();
 
 	discovery_stop(state);
+	discovery_fds_close(state);
 	devices_destroy(state);
+	pvt_members_free(&state->groups);
+	pvt_members_free(&state->providers);
 
+	ast_rwlock_destroy(&state->index_lock);
 	ast_mutex_destroy(&state->discovery_lock);
 	AST_RWLIST_HEAD_DESTROY(&state->devices);
 }
@@ -2024,6 +3089,7 @@ EXPORT_DEF void pvt_reload(restate_time_t when)
 {
 	unsigned dev_reload = 0;
 	reload_config(gpublic, 1, when, &dev_reload);
+	manager_batch_reload();
 	if(dev_reload > 0)
 		discovery_restart(gpublic);
 }
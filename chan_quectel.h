@@ -20,6 +20,7 @@
 #include "ast_compat.h"				/* asterisk compatibility fixes */
 
 #include "mixbuffer.h"				/* struct mixbuffer */
+#include "histogram.h"				/* struct histogram */
 //#include "ringbuffer.h"				/* struct ringbuffer */
 #include "cpvt.h"				/* struct cpvt */
 #include "export.h"				/* EXPORT_DECL EXPORT_DEF */
@@ -46,7 +47,6 @@ static int silencethreshold = 1000;
 static int writedev = -1;
 
 #define MODULE_DESCRIPTION	"Channel Driver for Mobile Telephony"
-#define MAXQUECTELDEVICES	128
 
 INLINE_DECL const char * dev_state2str(dev_state_t state)
 {
@@ -85,40 +85,130 @@ typedef struct pvt_state
 
 #define PVT_STATE_T(state, name)			((state)->name)
 
-/* statictics */
+/* statictics, all fields are uint64_t updated by PVT_STAT_ADD() without lock */
 typedef struct pvt_stat
 {
-	uint32_t		at_tasks;			/*!< number of tasks added to queue */
-	uint32_t		at_cmds;			/*!< number of commands added to queue */
-	uint32_t		at_responses;			/*!< number of responses handled */
+	uint64_t		at_tasks;			/*!< number of tasks added to queue */
+	uint64_t		at_cmds;			/*!< number of commands added to queue */
+	uint64_t		at_responses;			/*!< number of responses handled */
 
-	uint32_t		d_read_bytes;			/*!< number of bytes of commands actually read from device */
-	uint32_t		d_write_bytes;			/*!< number of bytes of commands actually written to device */
+	uint64_t		d_read_bytes;			/*!< number of bytes of commands actually read from device */
+	uint64_t		d_write_bytes;			/*!< number of bytes of commands actually written to device */
 
 	uint64_t		a_read_bytes;			/*!< number of bytes of audio read from device */
 	uint64_t		a_write_bytes;			/*!< number of bytes of audio written to device */
 
-	uint32_t		read_frames;			/*!< number of frames read from device */
-	uint32_t		read_sframes;			/*!< number of truncated frames read from device */
+	uint64_t		read_frames;			/*!< number of frames read from device */
+	uint64_t		read_sframes;			/*!< number of truncated frames read from device */
 
-	uint32_t		write_frames;			/*!< number of tries to frame write */
-	uint32_t		write_tframes;			/*!< number of truncated frames to write */
-	uint32_t		write_sframes;			/*!< number of silence frames to write */
+	uint64_t		write_frames;			/*!< number of tries to frame write */
+	uint64_t		write_tframes;			/*!< number of truncated frames to write */
+	uint64_t		write_sframes;			/*!< number of silence frames to write */
 
 	uint64_t		write_rb_overflow_bytes;	/*!< number of overflow bytes */
-	uint32_t		write_rb_overflow;		/*!< number of times when a_write_rb overflowed */
+	uint64_t		write_rb_overflow;		/*!< number of times when a_write_rb overflowed */
 
-	uint32_t		in_calls;			/*!< number of incoming calls not including waiting */
-	uint32_t		cw_calls;			/*!< number of waiting calls */
-	uint32_t		out_calls;			/*!< number of all outgoing calls attempts */
-	uint32_t		in_calls_handled;		/*!< number of ncoming/waiting calls passed to dialplan */
-	uint32_t		in_pbx_fails;			/*!< number of start_pbx fails */
+	uint64_t		in_calls;			/*!< number of incoming calls not including waiting */
+	uint64_t		cw_calls;			/*!< number of waiting calls */
+	uint64_t		out_calls;			/*!< number of all outgoing calls attempts */
+	uint64_t		in_calls_handled;		/*!< number of ncoming/waiting calls passed to dialplan */
+	uint64_t		in_pbx_fails;			/*!< number of start_pbx fails */
 
-	uint32_t		calls_answered[2];		/*!< number of outgoing and incoming/waiting calls answered */
-	uint32_t		calls_duration[2];		/*!< seconds of outgoing and incoming/waiting calls */
+	uint64_t		calls_answered[2];		/*!< number of outgoing and incoming/waiting calls answered */
+	uint64_t		calls_duration[2];		/*!< seconds of outgoing and incoming/waiting calls */
+
+	uint64_t		at_timeouts[AT_CMDS_NUMBER];	/*!< number of commands without response in time */
+	uint64_t		at_errors[AT_CMDS_NUMBER];	/*!< number of commands answered by ERROR */
+	uint64_t		at_cms_errors[AT_CMDS_NUMBER];	/*!< number of commands answered by +CMS ERROR */
+
+	struct histogram	at_latency[AT_CMDS_NUMBER];	/*!< microseconds from command write to its response */
+	struct histogram	a_read_jitter;			/*!< microseconds of frame read interval deviation */
+	struct histogram	a_write_jitter;			/*!< microseconds of frame write interval deviation */
+	struct histogram	lock_hold;			/*!< microseconds of pvt lock held by monitor thread */
 } pvt_stat_t;
 
 #define PVT_STAT_T(stat, name)			((stat)->name)
+#define PVT_STAT_ADD(pvt, name, n)		__atomic_fetch_add(&PVT_STAT(pvt, name), (n), __ATOMIC_RELAXED)
+
+/* device state for readers which must not wait for pvt lock */
+struct pvt_status
+{
+	const char *		state;				/*!< pvt_str_state() */
+	int			group;
+	int			gsm_reg_status;
+	int			rssi;
+	int			linkmode;
+	int			linksubmode;
+	unsigned int		ready4voice:1;			/*!< connected, initialized, registered, enabled and has voice */
+	unsigned int		ready4sms:1;			/*!< same for sms, see ready4sms() */
+	char			provider_name[32];
+	char			model[32];
+	char			firmware[32];
+	char			imei[17];
+	char			imsi[17];
+	char			subscriber_number[128];
+};
+
+/* copy of device for long output without holding locks, see pvt_snapshot_fill() */
+struct pvt_snapshot
+{
+	pvt_config_t		settings;
+	pvt_state_t		state;
+	const char *		str_state;			/*!< pvt_str_state() */
+	char			str_state_ex[256];		/*!< pvt_str_state_ex() */
+	int			gsm_reg_status;
+	int			rssi;
+	int			linkmode;
+	int			linksubmode;
+	char			provider_name[32];
+	char			manufacturer[32];
+	char			model[32];
+	char			firmware[32];
+	char			imei[17];
+	char			imsi[17];
+	char			subscriber_number[128];
+	char			location_area_code[8];
+	char			cell_id[8];
+	char			sms_scenter[20];
+	unsigned int		use_ucs2_encoding:1;
+	unsigned int		has_voice:1;
+	unsigned int		has_sms:1;
+	unsigned int		has_call_waiting:1;
+	dev_state_t		current_state;
+	dev_state_t		desired_state;
+	restate_time_t		restart_time;
+};
+
+/* hash indexes of devices, see find_device_ex() */
+typedef enum {
+	PVT_INDEX_ID = 0,
+	PVT_INDEX_IMEI,
+	PVT_INDEX_IMSI,
+	PVT_INDEX_COUNT
+} pvt_index_t;
+
+#define PVT_INDEX_SIZE		256
+
+struct pvt_index_node
+{
+	struct pvt_index_node *	next;				/*!< next node in bucket */
+	struct pvt *		pvt;
+	unsigned int		hash;
+	unsigned int		linked:1;
+	char			key[32];			/*!< copy of indexed value, changed under index_lock */
+};
+
+/* devices of one group or provider for resource selection, see find_device_by_resource_ex() */
+struct pvt_members
+{
+	struct pvt_members *	next;
+	int			group;				/*!< group number, unused for provider */
+	char			provider[32];			/*!< provider name, empty for group */
+	unsigned int		cursor;				/*!< position after last used device, atomic */
+	unsigned int		count;
+	unsigned int		size;
+	struct pvt **		pvts;				/*!< devices in order of joining */
+};
 
 struct at_queue_task;
 
@@ -132,7 +222,12 @@ typedef struct pvt
 	AST_LIST_ENTRY (pvt)	entry;				/*!< linked list pointers */
 
 	ast_mutex_t		lock;				/*!< pvt lock */
+	ast_mutex_t		a_lock;				/*!< audio lock, taken after lock when both needed: a_write_mixb, a_timer, dsp, dtmf_*, audio descriptors, chans list changes */
 	AST_LIST_HEAD_NOLOCK (, at_queue_task) at_queue;	/*!< queue for commands to modem */
+	AST_LIST_HEAD_NOLOCK (, at_sms)	sms_spool;		/*!< prepared SMS waiting for send rate limit */
+	unsigned int		sms_spool_count;		/*!< number of messages in sms_spool */
+	struct timeval		sms_spool_next;			/*!< earliest time of moving next sms_spool message to at_queue */
+	struct timeval		sms_resume_next;		/*!< time of next smsdb poll for messages to resend */
 
 	AST_LIST_HEAD_NOLOCK (, cpvt)		chans;		/*!< list of channels */
 	struct cpvt		sys_chan;			/*!< system channel */
@@ -159,10 +254,17 @@ typedef struct pvt
 //	struct ast_frame	a_read_frame;			/*!< read frame buffer */
 
 
+	struct timeval		a_read_last;			/*!< time of last frame read, for jitter statistics */
+	struct timeval		a_write_last;			/*!< time of last frame write */
+
 	char			dtmf_digit;			/*!< last DTMF digit */
 	struct timeval		dtmf_begin_time;		/*!< time of begin of last DTMF digit */
 	struct timeval		dtmf_end_time;			/*!< time of end of last DTMF digit */
 
+	char			* scratch;			/*!< arena for response handlers of monitor thread, see pvt_scratch() */
+	size_t			scratch_used;			/*!< bytes taken from arena for current response */
+#define PVT_SCRATCH_SIZE	(128 * 1024)
+
 	int			timeout;			/*!< used to set the timeout for data */
 #define DATA_READ_TIMEOUT	10000				/* 10 seconds */
 
@@ -213,10 +315,6 @@ typedef struct pvt
 	unsigned int		call_estb:1;
 	unsigned int		has_call_waiting:1;		/*!< call waiting enabled on device */
 
-	unsigned int		group_last_used:1;		/*!< mark the last used device */
-	unsigned int		prov_last_used:1;		/*!< mark the last used device */
-	unsigned int		sim_last_used:1;		/*!< mark the last used device */
-
 	unsigned int		terminate_monitor:1;		/*!< non-zero if we want terminate monitor thread i.e. restart, stop, remove */
 //	unsigned int		off:1;				/*!< device not used */
 //	unsigned int		prevent_new:1;			/*!< prevent new usage */
@@ -232,6 +330,12 @@ typedef struct pvt
 	pvt_config_t		settings;			/*!< all device settings from config file */
 	pvt_state_t		state;				/*!< state */
 	pvt_stat_t		stat;				/*!< various statistics */
+
+	volatile unsigned int	status_seq;			/*!< odd while status is written */
+	struct pvt_status	status;				/*!< published copy of device state, see pvt_status_get() */
+	struct pvt_index_node	index_nodes[PVT_INDEX_COUNT];	/*!< entries in public_state index */
+	struct pvt_members *	group_members;			/*!< members of group this device is in, changed under index_lock */
+	struct pvt_members *	provider_members;		/*!< same for provider */
 } pvt_t;
 
 #define CONF_GLOBAL(name)		(gpublic->global_settings.name)
@@ -250,7 +354,14 @@ typedef struct public_state
 	ast_mutex_t			discovery_lock;
 	pthread_t			discovery_thread;		/* The discovery thread handler */
 	volatile int			unloading_flag;			/* no need mutex or other locking for protect this variable because no concurent r/w and set non-0 atomically */
+	int				discovery_wake[2];		/* pipe written by discovery_restart() to wake up discovery thread */
+	int				discovery_uevent;		/* hotplug events socket or -1 */
 	struct dc_gconfig		global_settings;
+	ast_rwlock_t			index_lock;			/* lock for index, taken after devices and pvt lock */
+	struct pvt_index_node *		index[PVT_INDEX_COUNT][PVT_INDEX_SIZE];	/* devices by id, imei and imsi */
+	struct pvt_members *		groups;				/* devices by group, under index_lock */
+	struct pvt_members *		providers;			/* devices by provider, under index_lock */
+	unsigned int			sim_cursor;			/* round robin position for s:<imsi prefix>, atomic */
 } public_state_t;
 
 EXPORT_DECL public_state_t * gpublic;
@@ -276,6 +387,14 @@ EXPORT_DECL void pvt_on_remove_last_channel(struct pvt* pvt);
 EXPORT_DECL void pvt_reload(restate_time_t when);
 EXPORT_DECL int pvt_enabled(const struct pvt * pvt);
 EXPORT_DECL void pvt_try_restate(struct pvt * pvt);
+EXPORT_DECL int pvt_sms_spool_run(struct pvt * pvt);
+EXPORT_DECL void * pvt_scratch(struct pvt * pvt, size_t size);
+EXPORT_DECL void pvt_status_publish(struct pvt * pvt);
+EXPORT_DECL void pvt_status_get(const struct pvt * pvt, struct pvt_status * status);
+EXPORT_DECL void pvt_stat_get(const struct pvt * pvt, pvt_stat_t * stat);
+EXPORT_DECL void pvt_state_get(const struct pvt * pvt, pvt_state_t * state);
+EXPORT_DECL void pvt_snapshot_fill(const struct pvt * pvt, struct pvt_snapshot * snap);
+EXPORT_DECL struct pvt_snapshot * pvt_snapshot_list(const char * device, size_t * count);
 
 EXPORT_DECL int opentty (const char* dev, char ** lockfile, int typ);
 EXPORT_DECL void closetty(int fd, char ** lockfname);
@@ -296,6 +415,16 @@ INLINE_DECL struct pvt * find_device_by_resource(const char * resource, int opts
 	return find_device_by_resource_ex(gpublic, resource, opts, requestor, exists);
 }
 
+EXPORT_DECL int pvt_match_resource(const struct pvt * pvt, const char * resource);
+EXPORT_DECL int ready4sms(const struct pvt * pvt);
+EXPORT_DECL unsigned pvt_sms_backlog(const struct pvt * pvt);
+EXPORT_DECL struct pvt * find_device_for_sms_ex(struct public_state * state, const char * resource);
+
+INLINE_DECL struct pvt * find_device_for_sms(const char * resource)
+{
+	return find_device_for_sms_ex(gpublic, resource);
+}
+
 EXPORT_DECL struct ast_module * self_module();
 
 #define PVT_NO_CHANS(pvt)		(PVT_STATE(pvt, chansno) == 0)
@@ -294,7 +294,7 @@ static int channel_call(struct ast_channel* channel, char* dest, attribute_unuse
 		clir = -1;
 	}
 
-	PVT_STAT(pvt, out_calls) ++;
+	PVT_STAT_ADD(pvt, out_calls, 1);
 	if (at_enqueue_dial(cpvt, dest_num, clir))
 	{
 		ast_mutex_unlock (&pvt->lock);
@@ -315,11 +315,13 @@ static void disactivate_call(struct cpvt* cpvt)
 
 	if(cpvt->channel && CPVT_TEST_FLAG(cpvt, CALL_FLAG_ACTIVATED))
 	{
+		ast_mutex_lock (&pvt->a_lock);
                 if (strcmp(CONF_UNIQ(pvt, quec_uac),"1") == 0) snd_pcm_drop(pvt->icard);
 		else mixb_detach(&cpvt->pvt->a_write_mixb, &cpvt->mixstream);
+		CPVT_RESET_FLAGS(cpvt, CALL_FLAG_ACTIVATED | CALL_FLAG_MASTER);
+		ast_mutex_unlock (&pvt->a_lock);
 		ast_channel_set_fd (cpvt->channel, 1, -1);
 		ast_channel_set_fd (cpvt->channel, 0, -1);
-		CPVT_RESET_FLAGS(cpvt, CALL_FLAG_ACTIVATED | CALL_FLAG_MASTER);
 
 		ast_debug (6, "[%s] call idx %d disactivated\n", PVT_ID(cpvt->pvt), cpvt->call_idx);
 	}
@@ -346,7 +348,9 @@ static void activate_call(struct cpvt* cpvt)
 				ast_debug (6, "[%s] call idx %d gave master\n", PVT_ID(pvt), cpvt2->call_idx);
 			}
 
+			ast_mutex_lock (&pvt->a_lock);
 			CPVT_RESET_FLAGS(cpvt2, CALL_FLAG_MASTER);
+			ast_mutex_unlock (&pvt->a_lock);
 			if(cpvt2->channel)
 			{
 				ast_channel_set_fd (cpvt2->channel, 1, -1);
@@ -363,6 +367,7 @@ static void activate_call(struct cpvt* cpvt)
 	if(!CPVT_TEST_FLAG(cpvt, CALL_FLAG_ACTIVATED))
 	{
 		// FIXME: reset possition?
+		ast_mutex_lock (&pvt->a_lock);
 		if (strcmp(CONF_UNIQ(pvt, quec_uac),"1") != 0) mixb_attach(&pvt->a_write_mixb, &cpvt->mixstream);
                 else {
 	        snd_pcm_state_t state;
@@ -372,6 +377,7 @@ static void activate_call(struct cpvt* cpvt)
                 snd_pcm_start(pvt->icard);
                                                                                             }
                       }                
+		ast_mutex_unlock (&pvt->a_lock);
 //		rb_init (&cpvt->a_write_rb, cpvt->a_write_buf, sizeof (cpvt->a_write_buf));
 //		cpvt->write = pvt->a_write_rb.write;
 //		cpvt->used = pvt->a_write_rb.used;
@@ -379,7 +385,12 @@ static void activate_call(struct cpvt* cpvt)
 
 	if (pvt->audio_fd >= 0)
 	{
+		ast_mutex_lock (&pvt->a_lock);
 		CPVT_SET_FLAGS(cpvt, CALL_FLAG_ACTIVATED | CALL_FLAG_MASTER);
+		if(pvt->dsp)
+			ast_dsp_digitreset(pvt->dsp);
+		pvt->dtmf_digit = 0;
+		ast_mutex_unlock (&pvt->a_lock);
 		if(cpvt->channel)
 		{
 			ast_channel_set_fd (cpvt->channel, 0, pvt->audio_fd);
@@ -391,9 +402,6 @@ static void activate_call(struct cpvt* cpvt)
 */
 			}
 		}
-		if(pvt->dsp)
-			ast_dsp_digitreset(pvt->dsp);
-		pvt->dtmf_digit = 0;
 		ast_debug (6, "[%s] call idx %d was master\n", PVT_ID(pvt), cpvt->call_idx);
 	}
 }
@@ -508,6 +516,20 @@ static int channel_digit_end (attribute_unused struct ast_channel* channel, attr
 	return 0;
 }
 
+#/* account deviation of frame interval from frame duration; audio lock must be held */
+static void frame_jitter(struct histogram * hist, struct timeval * last)
+{
+	struct timeval now = ast_tvnow();
+	int64_t us = ast_tvdiff_us(now, *last) - FRAME_DURATION_US;
+
+	/* skip first frame and pauses */
+	if (!ast_tvzero(*last) && us < 1000000)
+	{
+		hist_add(hist, us < 0 ? -us : us);
+	}
+	*last = now;
+}
+
 #/* ARCH: move to cpvt level */
 static void iov_write(struct pvt* pvt, int fd, struct iovec * iov, int iovcnt)
 {
@@ -551,7 +573,7 @@ again:
 			} while(written > 0);
 		}
 	}
-	PVT_STAT(pvt, a_write_bytes) += done;
+	PVT_STAT_ADD(pvt, a_write_bytes, done);
 
 	if (done != FRAME_SIZE)
 	{
@@ -600,7 +622,7 @@ static void timing_write(struct pvt* pvt)
 		}
 		else if (used > 0)
 		{
-			PVT_STAT(pvt, write_tframes) ++;
+			PVT_STAT_ADD(pvt, write_tframes, 1);
 			msg = "[%s] write truncated frame\n";
 
 			iovcnt = mixb_read_all_iov (&pvt->a_write_mixb, iov);
@@ -614,7 +636,7 @@ static void timing_write(struct pvt* pvt)
 		}
 		else
 		{
-			PVT_STAT(pvt, write_sframes) ++;
+			PVT_STAT_ADD(pvt, write_sframes, 1);
 			msg = "[%s] write silence\n";
 
 			iov[0].iov_base		= silence_frame;
@@ -631,7 +653,8 @@ static void timing_write(struct pvt* pvt)
 //	}
 
 
-	PVT_STAT(pvt, write_frames) ++;
+	PVT_STAT_ADD(pvt, write_frames, 1);
+	frame_jitter(&PVT_STAT(pvt, a_write_jitter), &pvt->a_write_last);
 	iov_write(pvt, pvt->audio_fd, iov, iovcnt);
 //	if(write_all(pvt->audio_fd, buffer, sizeof(buffer)) != sizeof(buffer))
 //		ast_debug (1, "[%s] Write error!\n", PVT_ID(pvt));
@@ -683,9 +706,12 @@ static struct ast_frame* channel_read (struct ast_channel* channel)
 	}
 	pvt = cpvt->pvt;
 
-	while (ast_mutex_trylock (&pvt->lock))
+	/* audio lock is taken last, so no deadlock avoidance */
+	ast_mutex_lock (&pvt->a_lock);
+	if (ast_channel_tech_pvt(channel) != cpvt)
 	{
-		CHANNEL_DEADLOCK_AVOIDANCE (channel);
+		ast_mutex_unlock (&pvt->a_lock);
+		return f;
 	}
 
 	ast_debug (7, "[%s] read call idx %d state %d audio_fd %d\n", PVT_ID(pvt), cpvt->call_idx, cpvt->state, pvt->audio_fd);
@@ -741,10 +767,11 @@ static struct ast_frame* channel_read (struct ast_channel* channel)
 			if(CPVT_TEST_FLAG(cpvt, CALL_FLAG_MULTIPARTY))
 				write_conference(pvt, cpvt->a_read_frame.data.ptr, res);
 
-			PVT_STAT(pvt, a_read_bytes) += res;
-			PVT_STAT(pvt, read_frames) ++;
+			PVT_STAT_ADD(pvt, a_read_bytes, res);
+			PVT_STAT_ADD(pvt, read_frames, 1);
+			frame_jitter(&PVT_STAT(pvt, a_read_jitter), &pvt->a_read_last);
 			if(res < FRAME_SIZE)
-				PVT_STAT(pvt, read_sframes) ++;
+				PVT_STAT_ADD(pvt, read_sframes, 1);
 		}
 
 		cpvt->a_read_frame.samples	= res / 2;
@@ -817,7 +844,7 @@ static struct ast_frame* channel_read (struct ast_channel* channel)
 	}
 
 e_return:
-	ast_mutex_unlock (&pvt->lock);
+	ast_mutex_unlock (&pvt->a_lock);
 
 	return f;
         }
@@ -863,7 +890,7 @@ e_return:
 
 	/* Return NULL frame on error */
 	if (r < 0) {
-		ast_mutex_unlock (&pvt->lock);
+		ast_mutex_unlock (&pvt->a_lock);
 		return &f;
 	}
 	readpos += r;
@@ -876,7 +903,7 @@ e_return:
 #if 0
                 if (ast_channel_state(channel) != AST_STATE_UP){
 			/* Don't transmit unless it's up */
-			ast_mutex_unlock(&pvt->lock);
+			ast_mutex_unlock (&pvt->a_lock);
 			return &f;
 		}
 #endif
@@ -898,7 +925,7 @@ e_return:
 				{
 					p->frametype = AST_FRAME_NULL;
 					p->subclass_integer = 0;
-						ast_mutex_unlock (&pvt->lock);
+						ast_mutex_unlock (&pvt->a_lock);
 
 	                                        return p;
 				}
@@ -938,20 +965,56 @@ e_return:
 					}
 
 				}
-					ast_mutex_unlock (&pvt->lock);
+					ast_mutex_unlock (&pvt->a_lock);
 
 	                                return p;
 			}
 		}
 	}
 
-	ast_mutex_unlock (&pvt->lock);
+	ast_mutex_unlock (&pvt->a_lock);
 
 	return &f;
         }
 
 }
 
+#/* check once per call for bridge with other channel of same device, return non-zero if found */
+static int channel_bridge_loop (struct ast_channel* channel, struct cpvt* cpvt)
+{
+	struct pvt* pvt = cpvt->pvt;
+	int loop = 0;
+
+	/* flags of both calls are changed under device lock */
+	while (ast_mutex_trylock (&pvt->lock))
+	{
+		CHANNEL_DEADLOCK_AVOIDANCE (channel);
+	}
+
+	if(ast_channel_tech_pvt(channel) == cpvt && CPVT_IS_ACTIVE(cpvt) && !CPVT_TEST_FLAG(cpvt, CALL_FLAG_BRIDGE_CHECK))
+	{
+#if ASTERISK_VERSION_NUM >= 120000 /* 12+ */
+		RAII_VAR(struct ast_channel *, bridged, ast_channel_bridge_peer(channel), ast_channel_cleanup);
+#else /* 12- */
+		struct ast_channel *bridged = ast_bridged_channel(channel);
+#endif /* ^12- */
+		struct cpvt *tmp_cpvt;
+
+		CPVT_SET_FLAGS(cpvt, CALL_FLAG_BRIDGE_CHECK);
+
+		if (bridged && ast_channel_tech(bridged) == &channel_tech && (tmp_cpvt = ast_channel_tech_pvt(bridged)) && tmp_cpvt->pvt == pvt)
+		{
+			CPVT_SET_FLAGS(cpvt, CALL_FLAG_BRIDGE_LOOP);
+			CPVT_SET_FLAGS((struct cpvt*)ast_channel_tech_pvt(bridged), CALL_FLAG_BRIDGE_LOOP);
+			ast_log(LOG_WARNING, "[%s] Bridged channels %s and %s working on same device, discard writes to avoid voice loop\n", PVT_ID(pvt), ast_channel_name(channel), ast_channel_name(bridged));
+			loop = 1;
+		}
+	}
+
+	ast_mutex_unlock (&pvt->lock);
+	return loop;
+}
+
 #/* */
 static int channel_write (struct ast_channel* channel, struct ast_frame* f)
 {
@@ -992,34 +1055,14 @@ static int channel_write (struct ast_channel* channel, struct ast_frame* f)
 	int gains[2];
 
 
-	while (ast_mutex_trylock (&pvt->lock))
-	{
-		CHANNEL_DEADLOCK_AVOIDANCE (channel);
-	}
+	if(CPVT_TEST_FLAG(cpvt, CALL_FLAG_MULTIPARTY) && !CPVT_TEST_FLAG(cpvt, CALL_FLAG_BRIDGE_CHECK) && channel_bridge_loop(channel, cpvt))
+		return 0;
 
-	if(!CPVT_IS_ACTIVE(cpvt))
+	/* audio lock is taken last, so no deadlock avoidance */
+	ast_mutex_lock (&pvt->a_lock);
+	if(ast_channel_tech_pvt(channel) != cpvt || !CPVT_IS_ACTIVE(cpvt))
 		goto e_return;
 
-	if(CPVT_TEST_FLAG(cpvt, CALL_FLAG_MULTIPARTY) && !CPVT_TEST_FLAG(cpvt, CALL_FLAG_BRIDGE_CHECK))
-	{
-#if ASTERISK_VERSION_NUM >= 120000 /* 12+ */
-		RAII_VAR(struct ast_channel *, bridged, ast_channel_bridge_peer(channel), ast_channel_cleanup);
-#else /* 12- */
-		struct ast_channel *bridged = ast_bridged_channel(channel);
-#endif /* ^12- */
-		struct cpvt *tmp_cpvt;
-
-		CPVT_SET_FLAGS(cpvt, CALL_FLAG_BRIDGE_CHECK);
-
-		if (bridged && ast_channel_tech(bridged) == &channel_tech && (tmp_cpvt = ast_channel_tech_pvt(bridged)) && tmp_cpvt->pvt == pvt)
-		{
-			CPVT_SET_FLAGS(cpvt, CALL_FLAG_BRIDGE_LOOP);
-			CPVT_SET_FLAGS((struct cpvt*)ast_channel_tech_pvt(bridged), CALL_FLAG_BRIDGE_LOOP);
-			ast_log(LOG_WARNING, "[%s] Bridged channels %s and %s working on same device, discard writes to avoid voice loop\n", PVT_ID(pvt), ast_channel_name(channel), ast_channel_name(bridged));
-			goto e_return;
-		}
-	}
-
 	if (pvt->audio_fd < 0)
 	{
 		ast_debug (1, "[%s] audio_fd not ready\n", PVT_ID(pvt));
@@ -1073,8 +1116,8 @@ static int channel_write (struct ast_channel* channel, struct ast_frame* f)
 			{
 				mixb_read_upd (&pvt->a_write_mixb, f->datalen - count);
 
-				PVT_STAT(pvt, write_rb_overflow_bytes) += f->datalen - count;
-				PVT_STAT(pvt, write_rb_overflow) ++;
+				PVT_STAT_ADD(pvt, write_rb_overflow_bytes, f->datalen - count);
+				PVT_STAT_ADD(pvt, write_rb_overflow, 1);
 			}
 
 			mixb_write (&pvt->a_write_mixb, &cpvt->mixstream, f->data.ptr, f->datalen);
@@ -1108,7 +1151,7 @@ static int channel_write (struct ast_channel* channel, struct ast_frame* f)
 				iov[1].iov_base = silence_frame;
 				iov[1].iov_len = FRAME_SIZE - f->datalen;
 				iovcnt = 2;
-				PVT_STAT(pvt, write_tframes) ++;
+				PVT_STAT_ADD(pvt, write_tframes, 1);
 			}
 			else
 			{
@@ -1116,7 +1159,8 @@ static int channel_write (struct ast_channel* channel, struct ast_frame* f)
 			}
 
 			iov_write(pvt, pvt->audio_fd, iov, iovcnt);
-			PVT_STAT(pvt, write_frames) ++;
+			PVT_STAT_ADD(pvt, write_frames, 1);
+			frame_jitter(&PVT_STAT(pvt, a_write_jitter), &pvt->a_write_last);
 			}
 		}
 
@@ -1128,7 +1172,7 @@ static int channel_write (struct ast_channel* channel, struct ast_frame* f)
 	}
 
 e_return:
-	ast_mutex_unlock (&pvt->lock);
+	ast_mutex_unlock (&pvt->a_lock);
 
 	return 0;
              }
@@ -1141,10 +1185,7 @@ e_return:
 	snd_pcm_state_t state;
 
 
-	while (ast_mutex_trylock (&pvt->lock))
-	{
-		CHANNEL_DEADLOCK_AVOIDANCE (channel);
-	}
+	ast_mutex_lock (&pvt->a_lock);
 	if (f->datalen > sizeof(sizbuf) - sizpos) {
 		ast_log(LOG_WARNING, "Frame too large\n");
 		res = -1;
@@ -1180,7 +1221,7 @@ e_return:
 		}
 	}
 
-	ast_mutex_unlock (&pvt->lock);
+	ast_mutex_unlock (&pvt->a_lock);
 
 	return res >= 0 ? 0 : res;
            }
@@ -1308,7 +1349,9 @@ EXPORT_DEF void change_channel_state(struct cpvt * cpvt, unsigned newstate, int
 		channel = cpvt->channel;
 		call_idx = cpvt->call_idx;
 
+		ast_mutex_lock (&pvt->a_lock);
 		cpvt->state = newstate;
+		ast_mutex_unlock (&pvt->a_lock);
 		PVT_STATE(pvt, chan_count[oldstate])--;
 		PVT_STATE(pvt, chan_count[newstate])++;
 
@@ -1405,6 +1448,7 @@ EXPORT_DEF void change_channel_state(struct cpvt * cpvt, unsigned newstate, int
 					break;
 			}
 		}
+		pvt_status_publish(pvt);
 		manager_event_call_state_change(PVT_ID(pvt), call_idx, call_state2str(newstate));
 	}
 }
@@ -15,12 +15,19 @@
 #include <sys/types.h>
 
 #include <iconv.h>			/* iconv_t iconv() */
+#include <pthread.h>			/* pthread_key_t pthread_once() */
+#include <stdlib.h>			/* malloc() free() */
 #include <string.h>			/* memcpy() */
 #include <stdio.h>			/* sscanf() snprintf() */
 #include <errno.h>			/* EINVAL */
 
 #include "char_conv.h"
 #include "mutils.h"			/* ITEMS_OF() */
+
+#if defined(__GNUC__) && (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#define HEX_SIMD_X86
+#include <immintrin.h>			/* SSE2 and AVX2 intrinsics */
+#endif
 #include "gsm7_luts.h"
 
 static char lut_hex2val[] = {
@@ -43,42 +50,206 @@ static char lut_hex2val[] = {
 };
 static const char *lut_val2hex = "0123456789ABCDEF";
 
-static ssize_t convert_string(const char *in, size_t in_length, char *out, size_t out_size, char *from, char *to)
+/* iconv descriptors of the fixed conversions, opened once per thread as iconv_open() is expensive */
+enum iconv_dir {
+	ICONV_UTF8_UCS2 = 0,
+	ICONV_UCS2_UTF8,
+	ICONV_DIRS
+};
+
+static const char * const iconv_charsets[ICONV_DIRS][2] = {
+	[ICONV_UTF8_UCS2] = { "UTF-8", "UTF-16BE" },
+	[ICONV_UCS2_UTF8] = { "UTF-16BE", "UTF-8" },
+};
+
+static pthread_key_t iconv_cache_key;
+static pthread_once_t iconv_cache_once = PTHREAD_ONCE_INIT;
+
+static void iconv_cache_free(void *data)
+{
+	ICONV_T *cds = data;
+	for (int i = 0; i < ICONV_DIRS; ++i) {
+		if (cds[i] != (ICONV_T)-1) {
+			iconv_close(cds[i]);
+		}
+	}
+	free(cds);
+}
+
+static void iconv_cache_init(void)
+{
+	pthread_key_create(&iconv_cache_key, iconv_cache_free);
+}
+
+static ICONV_T iconv_cached(enum iconv_dir dir)
+{
+	ICONV_T *cds;
+
+	pthread_once(&iconv_cache_once, iconv_cache_init);
+	cds = pthread_getspecific(iconv_cache_key);
+	if (!cds) {
+		cds = malloc(sizeof(*cds) * ICONV_DIRS);
+		if (!cds) {
+			return (ICONV_T)-1;
+		}
+		for (int i = 0; i < ICONV_DIRS; ++i) {
+			cds[i] = (ICONV_T)-1;
+		}
+		if (pthread_setspecific(iconv_cache_key, cds)) {
+			free(cds);
+			return (ICONV_T)-1;
+		}
+	}
+
+	if (cds[dir] == (ICONV_T)-1) {
+		cds[dir] = iconv_open(iconv_charsets[dir][1], iconv_charsets[dir][0]);
+	} else {
+		/* previous conversion may have failed in the middle */
+		iconv(cds[dir], NULL, NULL, NULL, NULL);
+	}
+	return cds[dir];
+}
+
+static ssize_t convert_string(const char *in, size_t in_length, char *out, size_t out_size, enum iconv_dir dir)
 {
 	ICONV_CONST char *in_ptr = (ICONV_CONST char*)in;
 	size_t in_bytesleft = in_length;
 	char *out_ptr = out;
 	size_t out_bytesleft = out_size - 1;
-	ICONV_T cd = (ICONV_T)-1;
+	ICONV_T cd;
 	ssize_t res;
 
-	cd = iconv_open(to, from);
+	cd = iconv_cached(dir);
 	if (cd == (ICONV_T)-1) {
 		return -1;
 	}
 
 	res = iconv(cd, &in_ptr, &in_bytesleft, &out_ptr, &out_bytesleft);
 	if (res < 0) {
-		iconv_close(cd);
 		return -1;
 	}
 
-	iconv_close(cd);
-
 	return out_ptr - out;
 }
 
-EXPORT_DEF ssize_t utf8_to_ucs2(const char *in, size_t in_length, uint16_t *out, size_t out_size)
+EXPORT_DEF ssize_t utf8_to_ucs2_iconv(const char *in, size_t in_length, uint16_t *out, size_t out_size)
 {
-	ssize_t res = convert_string(in, in_length, (char*)out, out_size * 2, "UTF-8", "UTF-16BE");
+	ssize_t res = convert_string(in, in_length, (char*)out, out_size * 2, ICONV_UTF8_UCS2);
 	if (res < 0) return res;
 	return res / 2;
 }
-EXPORT_DEF ssize_t ucs2_to_utf8(const uint16_t *in, size_t in_length, char *out, size_t out_size)
+EXPORT_DEF ssize_t ucs2_to_utf8_iconv(const uint16_t *in, size_t in_length, char *out, size_t out_size)
 {
-	return convert_string((const char*)in, in_length * 2, out, out_size, "UTF-16BE", "UTF-8");
+	return convert_string((const char*)in, in_length * 2, out, out_size, ICONV_UCS2_UTF8);
+}
+
+/*
+ * Hand-written conversions with the results of the iconv ones above: UTF-16BE
+ * in memory (surrogate pairs for non-BMP characters), strict validation, room
+ * for the terminating zero kept in out_size but not written.
+ */
+EXPORT_DEF ssize_t utf8_to_ucs2(const char *in, size_t in_length, uint16_t *out, size_t out_size)
+{
+	const uint8_t *s = (const uint8_t*)in;
+	const uint8_t *end = s + in_length;
+	uint8_t *d = (uint8_t*)out;
+	size_t max = out_size > 0 ? out_size - 1 : 0;
+	size_t n = 0;
+	uint32_t c;
+
+	while (s < end) {
+		c = *s;
+		if (c < 0x80) {
+			if (n >= max) return -1;
+			d[0] = 0;
+			d[1] = c;
+			d += 2;
+			++n;
+			++s;
+			continue;
+		} else if (c < 0xC2) {
+			/* continuation byte or overlong 2-byte sequence */
+			return -1;
+		} else if (c < 0xE0) {
+			if (end - s < 2 || (s[1] & 0xC0) != 0x80) return -1;
+			c = (c & 0x1F) << 6 | (s[1] & 0x3F);
+			s += 2;
+		} else if (c < 0xF0) {
+			if (end - s < 3 || (s[1] & 0xC0) != 0x80 || (s[2] & 0xC0) != 0x80) return -1;
+			c = (c & 0x0F) << 12 | (s[1] & 0x3F) << 6 | (s[2] & 0x3F);
+			if (c < 0x800 || (c >= 0xD800 && c <= 0xDFFF)) return -1;
+			s += 3;
+		} else if (c < 0xF5) {
+			if (end - s < 4 || (s[1] & 0xC0) != 0x80 || (s[2] & 0xC0) != 0x80 || (s[3] & 0xC0) != 0x80) return -1;
+			c = (c & 0x07) << 18 | (s[1] & 0x3F) << 12 | (s[2] & 0x3F) << 6 | (s[3] & 0x3F);
+			if (c < 0x10000 || c > 0x10FFFF) return -1;
+			s += 4;
+		} else {
+			return -1;
+		}
+
+		if (c >= 0x10000) {
+			if (n + 2 > max) return -1;
+			c -= 0x10000;
+			d[0] = 0xD8 | c >> 18;
+			d[1] = c >> 10;
+			d[2] = 0xDC | (c >> 8 & 0x03);
+			d[3] = c;
+			d += 4;
+			n += 2;
+		} else {
+			if (n >= max) return -1;
+			d[0] = c >> 8;
+			d[1] = c;
+			d += 2;
+			++n;
+		}
+	}
+	return n;
 }
+EXPORT_DEF ssize_t ucs2_to_utf8(const uint16_t *in, size_t in_length, char *out, size_t out_size)
+{
+	const uint8_t *s = (const uint8_t*)in;
+	const uint8_t *end = s + in_length * 2;
+	uint8_t *d = (uint8_t*)out;
+	size_t left = out_size > 0 ? out_size - 1 : 0;
+	uint32_t c;
 
+	for (; s < end; s += 2) {
+		c = s[0] << 8 | s[1];
+		if (c < 0x80) {
+			if (left < 1) return -1;
+			*d++ = c;
+			--left;
+		} else if (c < 0x800) {
+			if (left < 2) return -1;
+			*d++ = 0xC0 | c >> 6;
+			*d++ = 0x80 | (c & 0x3F);
+			left -= 2;
+		} else if (c < 0xD800 || c > 0xDFFF) {
+			if (left < 3) return -1;
+			*d++ = 0xE0 | c >> 12;
+			*d++ = 0x80 | (c >> 6 & 0x3F);
+			*d++ = 0x80 | (c & 0x3F);
+			left -= 3;
+		} else {
+			/* surrogate pair */
+			uint32_t lo;
+			if (c > 0xDBFF || end - s < 4) return -1;
+			lo = s[2] << 8 | s[3];
+			if (lo < 0xDC00 || lo > 0xDFFF) return -1;
+			c = 0x10000 + ((c & 0x3FF) << 10 | (lo & 0x3FF));
+			if (left < 4) return -1;
+			*d++ = 0xF0 | c >> 18;
+			*d++ = 0x80 | (c >> 12 & 0x3F);
+			*d++ = 0x80 | (c >> 6 & 0x3F);
+			*d++ = 0x80 | (c & 0x3F);
+			left -= 4;
+			s += 2;
+		}
+	}
+	return d - (uint8_t*)out;
+}
 
 static char hexchar2val(unsigned char h)
 {
@@ -88,65 +259,338 @@ static char val2hexchar(unsigned char h)
 {
 	return lut_val2hex[h];
 }
-EXPORT_DEF int unhex(const char *in, uint8_t *out)
+
+#ifdef HEX_SIMD_X86
+/* 32 hex chars to 16 bytes, return 0 if some char is not hex digit */
+static int unhex_block_sse2(const char *in, uint8_t *out)
 {
-	int len = 0, nibbles = 0;
-	while (in[0]) {
-		nibbles += 1 + !!in[1];
-		char p0 = hexchar2val(*in++);
-		char p1 = *in ? hexchar2val(*in++) : 0;
+	const __m128i c0 = _mm_set1_epi8('0'), ca = _mm_set1_epi8('a'), lower = _mm_set1_epi8(0x20);
+	const __m128i n9 = _mm_set1_epi8(9), n5 = _mm_set1_epi8(5), n10 = _mm_set1_epi8(10);
+	const __m128i hi_mask = _mm_set1_epi16(0x00F0);
+	__m128i v[2], valid = _mm_set1_epi8(-1);
+
+	for (int k = 0; k < 2; ++k) {
+		__m128i c = _mm_loadu_si128((const __m128i*)(in + k * 16));
+		__m128i d = _mm_sub_epi8(c, c0);
+		__m128i l = _mm_sub_epi8(_mm_or_si128(c, lower), ca);
+		/* unsigned x <= n as min(x, n) == x */
+		__m128i dm = _mm_cmpeq_epi8(_mm_min_epu8(d, n9), d);
+		__m128i lm = _mm_cmpeq_epi8(_mm_min_epu8(l, n5), l);
+		valid = _mm_and_si128(valid, _mm_or_si128(dm, lm));
+		__m128i n = _mm_or_si128(_mm_and_si128(dm, d), _mm_and_si128(lm, _mm_add_epi8(l, n10)));
+		/* pair of nibbles in 16 bit lane to byte */
+		v[k] = _mm_or_si128(_mm_and_si128(_mm_slli_epi16(n, 4), hi_mask), _mm_srli_epi16(n, 8));
+	}
+	if (_mm_movemask_epi8(valid) != 0xFFFF) {
+		return 0;
+	}
+	_mm_storeu_si128((__m128i*)out, _mm_packus_epi16(v[0], v[1]));
+	return 1;
+}
+
+/* 16 bytes to 32 hex chars */
+static void hexify_block_sse2(const uint8_t *in, char *out)
+{
+	const __m128i low = _mm_set1_epi8(0x0F), n9 = _mm_set1_epi8(9), c0 = _mm_set1_epi8('0'), cA = _mm_set1_epi8('A' - '0' - 10);
+	__m128i x = _mm_loadu_si128((const __m128i*)in);
+	__m128i hi = _mm_and_si128(_mm_srli_epi16(x, 4), low);
+	__m128i lo = _mm_and_si128(x, low);
+	__m128i n[2] = { _mm_unpacklo_epi8(hi, lo), _mm_unpackhi_epi8(hi, lo) };
+
+	for (int k = 0; k < 2; ++k) {
+		__m128i c = _mm_add_epi8(_mm_add_epi8(n[k], c0), _mm_and_si128(_mm_cmpgt_epi8(n[k], n9), cA));
+		_mm_storeu_si128((__m128i*)(out + k * 16), c);
+	}
+}
+
+__attribute__((target("avx2")))
+static int unhex_block_avx2(const char *in, uint8_t *out)
+{
+	const __m256i c0 = _mm256_set1_epi8('0'), ca = _mm256_set1_epi8('a'), lower = _mm256_set1_epi8(0x20);
+	const __m256i n9 = _mm256_set1_epi8(9), n5 = _mm256_set1_epi8(5), n10 = _mm256_set1_epi8(10);
+	const __m256i hi_mask = _mm256_set1_epi16(0x00F0);
+	__m256i v[2], valid = _mm256_set1_epi8(-1);
+
+	for (int k = 0; k < 2; ++k) {
+		__m256i c = _mm256_loadu_si256((const __m256i*)(in + k * 32));
+		__m256i d = _mm256_sub_epi8(c, c0);
+		__m256i l = _mm256_sub_epi8(_mm256_or_si256(c, lower), ca);
+		__m256i dm = _mm256_cmpeq_epi8(_mm256_min_epu8(d, n9), d);
+		__m256i lm = _mm256_cmpeq_epi8(_mm256_min_epu8(l, n5), l);
+		valid = _mm256_and_si256(valid, _mm256_or_si256(dm, lm));
+		__m256i n = _mm256_or_si256(_mm256_and_si256(dm, d), _mm256_and_si256(lm, _mm256_add_epi8(l, n10)));
+		v[k] = _mm256_or_si256(_mm256_and_si256(_mm256_slli_epi16(n, 4), hi_mask), _mm256_srli_epi16(n, 8));
+	}
+	if (_mm256_movemask_epi8(valid) != -1) {
+		return 0;
+	}
+	/* packus works per 128 bit lane */
+	_mm256_storeu_si256((__m256i*)out, _mm256_permute4x64_epi64(_mm256_packus_epi16(v[0], v[1]), 0xD8));
+	return 1;
+}
+
+__attribute__((target("avx2")))
+static void hexify_block_avx2(const uint8_t *in, char *out)
+{
+	const __m256i low = _mm256_set1_epi16(0x000F), n9 = _mm256_set1_epi8(9), c0 = _mm256_set1_epi8('0'), cA = _mm256_set1_epi8('A' - '0' - 10);
+	__m256i x = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)in));
+	/* high nibble to low byte of lane, low nibble to high byte */
+	__m256i n = _mm256_or_si256(_mm256_srli_epi16(x, 4), _mm256_slli_epi16(_mm256_and_si256(x, low), 8));
+	__m256i c = _mm256_add_epi8(_mm256_add_epi8(n, c0), _mm256_and_si256(_mm256_cmpgt_epi8(n, n9), cA));
+	_mm256_storeu_si256((__m256i*)out, c);
+}
+
+static int hex_has_avx2(void)
+{
+	static int avx2 = -1;
+	if (avx2 < 0) {
+		__builtin_cpu_init();
+		avx2 = __builtin_cpu_supports("avx2") ? 1 : 0;
+	}
+	return avx2;
+}
+#endif /* HEX_SIMD_X86 */
+
+/*!
+ * \brief Decode hex string, may be done in place
+ * \param in -- hex digits, upper or lower case
+ * \param in_length -- number of digits, odd last digit is high nibble of last byte
+ * \param out -- buffer for (in_length + 1) / 2 bytes
+ * \return number of decoded nibbles, -1 if input contains not hex digit
+ */
+EXPORT_DEF ssize_t unhex_len(const char *in, size_t in_length, uint8_t *out)
+{
+	size_t i = 0;
+
+#ifdef HEX_SIMD_X86
+	if (hex_has_avx2()) {
+		for (; i + 64 <= in_length; i += 64) {
+			if (!unhex_block_avx2(in + i, out + i / 2)) return -1;
+		}
+	}
+	for (; i + 32 <= in_length; i += 32) {
+		if (!unhex_block_sse2(in + i, out + i / 2)) return -1;
+	}
+#endif /* HEX_SIMD_X86 */
+
+	for (; i + 2 <= in_length; i += 2) {
+		char p0 = hexchar2val(in[i]);
+		char p1 = hexchar2val(in[i + 1]);
 		if (p0 == -1 || p1 == -1) {
 			return -1;
 		}
-		out[len++] = p0 << 4 | p1;
+		out[i / 2] = p0 << 4 | p1;
+	}
+	if (i < in_length) {
+		char p0 = hexchar2val(in[i]);
+		if (p0 == -1) {
+			return -1;
+		}
+		out[i / 2] = p0 << 4;
 	}
-	return nibbles;
+	return in_length;
 }
-EXPORT_DEF void hexify(const uint8_t *in, size_t in_length, char *out)
+EXPORT_DEF int unhex(const char *in, uint8_t *out)
 {
-	// code from end of string to allow in-place encoding
-	for (int i = in_length - 1; i >= 0; --i) {
-		char c0 = val2hexchar(in[i] >> 4), c1 = val2hexchar(in[i] & 15);
-		out[i * 2] = c0;
-		out[i * 2 + 1] = c1;
-	}
+	return unhex_len(in, strlen(in), out);
+}
+
+/*!
+ * \brief Encode bytes as upper case hex string, may be done in place
+ * \param out -- buffer for in_length * 2 + 1 chars, terminated by zero
+ * \return length of hex string
+ */
+EXPORT_DEF size_t hexify(const uint8_t *in, size_t in_length, char *out)
+{
+	size_t i = in_length;
+
 	out[in_length * 2] = '\0';
+
+	// code from end of string to allow in-place encoding, a block is loaded before its output is stored
+	for (; i % 16; --i) {
+		char c0 = val2hexchar(in[i - 1] >> 4), c1 = val2hexchar(in[i - 1] & 15);
+		out[i * 2 - 2] = c0;
+		out[i * 2 - 1] = c1;
+	}
+#ifdef HEX_SIMD_X86
+	if (hex_has_avx2()) {
+		for (; i; i -= 16) {
+			hexify_block_avx2(in + i - 16, out + i * 2 - 32);
+		}
+	}
+	for (; i; i -= 16) {
+		hexify_block_sse2(in + i - 16, out + i * 2 - 32);
+	}
+#else /* HEX_SIMD_X86 */
+	for (; i; --i) {
+		char c0 = val2hexchar(in[i - 1] >> 4), c1 = val2hexchar(in[i - 1] & 15);
+		out[i * 2 - 2] = c0;
+		out[i * 2 - 1] = c1;
+	}
+#endif /* HEX_SIMD_X86 */
+	return in_length * 2;
 }
 
-#/* */
-static const uint8_t *get_char_gsm7_encoding(uint16_t c)
+#define GSM7_ESC		0x1b
+
+/*!
+ * \brief Find reverse lookup entry of a character
+ * \param c -- UCS-2 character in message byte order
+ * \return entry, zero if the character is in no table
+ */
+static inline uint64_t gsm7_rev_entry(uint16_t c)
 {
-	int minor = c >> 8, major = c & 255;
-	int subtab = LUT_GSM7_REV1[major];
-	if (subtab == -1) return LUT_GSM7_REV2_INV;
-	return LUT_GSM7_REV2[subtab][minor];
+	uint16_t ch = (c >> 8) | (c << 8);
+	return GSM7_REV_ENTRY(ch);
 }
 
-EXPORT_DEF ssize_t gsm7_encode(const uint16_t *in, size_t in_length, uint16_t *out)
+/*!
+ * \brief Septet of a character in a table
+ * \param shift -- nonzero for single shift table
+ */
+static unsigned gsm7_rev_septet(uint16_t c, uint64_t e, unsigned table, int shift)
 {
-	// TODO: Should we check for other tables or just use UCS-2?
-	unsigned bytes = 0;
-	const uint8_t *escenc = get_char_gsm7_encoding(0x1B00);
-	for (unsigned i = 0; i < in_length; ++i) {
-		const uint8_t *enc = get_char_gsm7_encoding(in[i]);
-		uint8_t c = enc[0];
-		if (c == GSM7_INVALID) {
+	if (GSM7_REV_IS_MULTI(e)) {
+		uint16_t ch = (c >> 8) | (c << 8);
+		unsigned t = table | (shift ? 0x80 : 0);
+
+		for (unsigned i = 0; i < ITEMS_OF(GSM7_REV_MULTI); ++i) {
+			if (GSM7_REV_MULTI[i].ch == ch && GSM7_REV_MULTI[i].table == t) {
+				return GSM7_REV_MULTI[i].septet;
+			}
+		}
+	}
+	return shift ? GSM7_REV_SS_SEPTET(e) : GSM7_REV_LS_SEPTET(e);
+}
+
+/*!
+ * \brief Encode UCS-2 to GSM7 septets using national language tables
+ * \param ls -- locking shift table, 0 for default alphabet
+ * \param ss -- single shift table, 0 for default extension table
+ * \return number of septets, -1 if a character is not in the tables
+ *
+ * Escaped characters are stored as ESC << 8 | septet, as gsm7_pack() expects.
+ */
+EXPORT_DEF ssize_t gsm7_encode_ext(const uint16_t *in, size_t in_length, uint16_t *out, uint8_t ls, uint8_t ss)
+{
+	unsigned lbit = ls < GSM7_NATIONAL_TABLES ? 1 << ls : 0;
+	unsigned sbit = ss < GSM7_NATIONAL_TABLES ? 1 << ss : 0;
+	unsigned septets = 0;
+
+	for (size_t i = 0; i < in_length; ++i) {
+		uint64_t e = gsm7_rev_entry(in[i]);
+		int c = -1;
+
+		if (GSM7_REV_LOCKING(e) & lbit) {
+			c = gsm7_rev_septet(in[i], e, ls, 0);
+		} else if (GSM7_REV_SHIFT(e) & sbit) {
+			c = (GSM7_ESC << 8) | gsm7_rev_septet(in[i], e, ss, 1);
+		}
+		if (c < 0) {
 			return -1;
 		}
-		if (c > 127) {
-			bytes += 2;
-			out[i] = (escenc[0] << 8) | (c - 128);
-		} else {
-			++bytes;
-			out[i] = c;
+		out[i] = c;
+		septets += c > 127 ? 2 : 1;
+	}
+	return septets;
+}
+
+EXPORT_DEF ssize_t gsm7_encode(const uint16_t *in, size_t in_length, uint16_t *out)
+{
+	return gsm7_encode_ext(in, in_length, out, 0, 0);
+}
+
+/*!
+ * \brief Count septets of a message for each pair of national language tables
+ * \param septets -- septets[ls][ss], -1 if the pair can not encode the message
+ * \return number of usable pairs
+ */
+EXPORT_DEF int gsm7_tables_septets(const uint16_t *in, size_t in_length, int septets[GSM7_NATIONAL_TABLES][GSM7_NATIONAL_TABLES])
+{
+	/* bit ss of usable[ls] set while the pair can encode the message */
+	uint16_t usable[GSM7_NATIONAL_TABLES];
+	unsigned ls, ss;
+	int pairs = 0;
+
+	for (ls = 0; ls < GSM7_NATIONAL_TABLES; ++ls) {
+		usable[ls] = (GSM7_LOCKING_TABLES & (1 << ls)) ? (1 << GSM7_NATIONAL_TABLES) - 1 : 0;
+		for (ss = 0; ss < GSM7_NATIONAL_TABLES; ++ss) {
+			septets[ls][ss] = 0;
 		}
 	}
-	return bytes;
+
+	for (size_t i = 0; i < in_length; ++i) {
+		uint64_t e = gsm7_rev_entry(in[i]);
+		uint16_t lmask = GSM7_REV_LOCKING(e), smask = GSM7_REV_SHIFT(e);
+
+		for (ls = 0; ls < GSM7_NATIONAL_TABLES; ++ls) {
+			if (!usable[ls]) {
+				continue;
+			}
+			if (lmask & (1 << ls)) {
+				for (unsigned t = 0; t < GSM7_NATIONAL_TABLES; ++t) {
+					septets[ls][t]++;
+				}
+			} else {
+				usable[ls] &= smask;
+				for (unsigned t = 0; t < GSM7_NATIONAL_TABLES; ++t) {
+					septets[ls][t] += 2;
+				}
+			}
+		}
+	}
+
+	for (ls = 0; ls < GSM7_NATIONAL_TABLES; ++ls) {
+		for (ss = 0; ss < GSM7_NATIONAL_TABLES; ++ss) {
+			if (usable[ls] & (1 << ss)) {
+				++pairs;
+			} else {
+				septets[ls][ss] = -1;
+			}
+		}
+	}
+	return pairs;
+}
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define GSM7_SWAR
+#endif
+
+#ifdef GSM7_SWAR
+#/* squeeze low 7 bits of 8 bytes into 56 bits */
+static inline uint64_t gsm7_squeeze(uint64_t w)
+{
+	w &= 0x7F7F7F7F7F7F7F7FULL;
+	w = (w & 0x007F007F007F007FULL) | ((w & 0x7F007F007F007F00ULL) >> 1);
+	w = (w & 0x00003FFF00003FFFULL) | ((w & 0x3FFF00003FFF0000ULL) >> 2);
+	w = (w & 0x000000000FFFFFFFULL) | ((w & 0x0FFFFFFF00000000ULL) >> 4);
+	return w;
+}
+
+#/* spread 56 bits to 8 bytes of 7 bits, reverse of gsm7_squeeze() */
+static inline uint64_t gsm7_spread(uint64_t w)
+{
+	w = (w & 0x000000000FFFFFFFULL) | ((w & 0x00FFFFFFF0000000ULL) << 4);
+	w = (w & 0x00003FFF00003FFFULL) | ((w & 0x0FFFC0000FFFC000ULL) << 2);
+	w = (w & 0x007F007F007F007FULL) | ((w & 0x3F803F803F803F80ULL) << 1);
+	return w;
 }
+#endif /* GSM7_SWAR */
+
+/*!
+ * \brief Pack GSM7 septets
+ * \param in -- septets from gsm7_encode(), escaped characters take two septets
+ * \param out_padding -- fill bits before first septet
+ * \return length of packed data in nibbles, -1 if out is too small
+ *
+ * Runs of eight unescaped septets are packed to seven bytes in one step.
+ */
 EXPORT_DEF ssize_t gsm7_pack(const uint16_t *in, size_t in_length, char *out, size_t out_size, unsigned out_padding)
 {
-	size_t i, x;
-	unsigned value = 0;
+	uint8_t *o = (uint8_t *) out;
+	uint64_t acc = 0;
+	unsigned bits = out_padding;
+	size_t i = 0, x;
 
 	/* compute number of bytes we need for the final string, rounded up */
 	x = ((out_padding + (7 * in_length) + 7) / 8) + 1;
@@ -155,35 +599,69 @@ EXPORT_DEF ssize_t gsm7_pack(const uint16_t *in, size_t in_length, char *out, si
 	if (x > out_size)
 		return -1;
 
-	for (x = i = 0; i != in_length; i++) {
-		char c[] = { in[i] >> 8, in[i] & 255 };
+	x = 0;
+	while (i < in_length) {
+#ifdef GSM7_SWAR
+		if (i + 8 <= in_length && x + 8 <= out_size) {
+			uint64_t w = 0;
+			unsigned hi = 0;
 
-		for (int j = c[0] == 0; j < 2; ++j) {
-			value |= (c[j] & 0x7F) << out_padding;
-			out_padding += 7;
-			if (out_padding < 8)
+			for (unsigned k = 0; k < 8; ++k) {
+				hi |= in[i + k];
+				w |= (uint64_t) (in[i + k] & 0xff) << (k * 8);
+			}
+			if (!(hi & 0xff00)) {
+				/* bits < 8 pending, 63 bits at most */
+				acc |= gsm7_squeeze(w) << bits;
+				memcpy(o + x, &acc, 8);
+				x += 7;
+				acc >>= 56;
+				i += 8;
+				continue;
+			}
+		}
+#endif /* GSM7_SWAR */
+		for (unsigned j = in[i] >> 8 ? 0 : 1; j < 2; ++j) {
+			acc |= (uint64_t) ((j ? in[i] : in[i] >> 8) & 0x7F) << bits;
+			bits += 7;
+			if (bits < 8)
 				continue;
+			/* escaped characters are not counted above */
+			if (x >= out_size)
+				return -1;
 			/* output one byte */
-			out[x++] = value & 0xff;
-			value >>= 8;
-			out_padding -= 8;
+			o[x++] = acc & 0xff;
+			acc >>= 8;
+			bits -= 8;
 		}
+		++i;
 	}
-	if (out_padding != 0) {
-		out[x++] = value & 0xff;
+	if (bits != 0) {
+		if (x >= out_size)
+			return -1;
+		o[x++] = acc & 0xff;
 	}
 
 	/* return total string length in nibbles, excluding terminating zero */
-	return x * 2 - (out_padding == 1 || out_padding == 2 || out_padding == 3 ? 1 : 0);
+	return x * 2 - (bits == 1 || bits == 2 || bits == 3 ? 1 : 0);
 }
+
+/*!
+ * \brief Unpack GSM7 septets and decode them with national language tables
+ * \param in_nibbles -- length of packed data in nibbles
+ * \param in_padding -- fill bits before first septet
+ * \return number of UCS-2 characters, -1 if out is too small
+ *
+ * Eight septets are extracted from seven bytes in one step, only the table
+ * lookup is done per septet.
+ */
 EXPORT_DEF ssize_t gsm7_unpack_decode(const char *in, size_t in_nibbles, uint16_t *out, size_t out_size, unsigned in_padding, uint8_t ls, uint8_t ss)
 {
 	if (ls > 13) ls = 0;
 	if (ss > 13) ss = 0;
-	size_t i;
-	size_t x;
-	unsigned value = 0;
-	unsigned c;
+	const uint8_t *p = (const uint8_t *) in;
+	size_t bits, septets, early, m, x = 0;
+	int esc = 0;
 
 	if (out_size == 0) {
 		return -1;
@@ -195,34 +673,50 @@ EXPORT_DEF ssize_t gsm7_unpack_decode(const char *in, size_t in_nibbles, uint16_
 		return 0;
 	}
 
-	/* account for the bit padding */
-	in_padding = 7 - in_padding;
+	/* septets complete in data, and before its last nibble */
+	bits = in_nibbles * 4;
+	septets = bits >= in_padding ? (bits - in_padding) / 7 : 0;
+	early = bits - 4 >= in_padding ? (bits - 4 - in_padding) / 7 : 0;
 
-	/* parse the hexstring */
-	int esc = 0;
-	for (x = i = 0; i < in_nibbles; ++i) {
-		if (x >= out_size)
-			return -1;
-		c = in[i / 2];
-		if (i & 1) c >>= 4;
-		uint8_t n = c & 0xf;
-		value |= n << in_padding;
-		in_padding += 4;
-
-		while (in_padding >= 7 * 2) {
-			in_padding -= 7;
-			value >>= 7;
-			{
-				uint16_t val = (esc ? LUT_GSM7_SS16 : LUT_GSM7_LS16)[esc ? ss : ls][value & 0x7f];
-				if (val == 0x1b) {
-					esc = 1;
-				} else {
-					esc = 0;
-					out[x++] = ((val & 0xff) << 8) | (val >> 8);
-				}
+	for (m = 0; m < septets; ) {
+		size_t b = in_padding + 7 * m;
+		uint8_t sept[8];
+		unsigned n, k;
+#ifdef GSM7_SWAR
+		if (m + 8 <= septets && (b >> 3) + 8 <= (in_nibbles + 1) / 2) {
+			uint64_t w;
+			memcpy(&w, p + (b >> 3), 8);
+			w = gsm7_spread(w >> (b & 7));
+			memcpy(sept, &w, 8);
+			n = 8;
+		} else
+#endif /* GSM7_SWAR */
+		{
+			unsigned v = p[b >> 3] >> (b & 7);
+			if ((b & 7) > 1) {
+				v |= p[(b >> 3) + 1] << (8 - (b & 7));
+			}
+			sept[0] = v & 0x7f;
+			n = 1;
+		}
+
+		for (k = 0; k < n; ++k, ++m) {
+			uint16_t val;
+			if (x >= out_size)
+				return -1;
+			val = (esc ? LUT_GSM7_SS16 : LUT_GSM7_LS16)[esc ? ss : ls][sept[k]];
+			if (val == 0x1b) {
+				esc = 1;
+			} else {
+				esc = 0;
+				out[x++] = ((val & 0xff) << 8) | (val >> 8);
 			}
 		}
 	}
 
+	/* trailing nibbles without a septet still need room */
+	if (early == septets && x >= out_size)
+		return -1;
+
 	return x;
 }
@@ -8,11 +8,18 @@
 #include "export.h"			/* EXPORT_DECL EXPORT_DEF */
 #include <stdint.h>
 
+#define GSM7_NATIONAL_TABLES	14		/* default alphabet and 3GPP TS 23.038 national language tables */
+
 EXPORT_DECL ssize_t utf8_to_ucs2(const char *in, size_t in_length, uint16_t *out, size_t out_size);
 EXPORT_DECL ssize_t ucs2_to_utf8(const uint16_t *in, size_t in_length, char *out, size_t out_size);
+EXPORT_DECL ssize_t utf8_to_ucs2_iconv(const char *in, size_t in_length, uint16_t *out, size_t out_size);
+EXPORT_DECL ssize_t ucs2_to_utf8_iconv(const uint16_t *in, size_t in_length, char *out, size_t out_size);
 EXPORT_DECL int unhex(const char *in, uint8_t *out);
-EXPORT_DECL void hexify(const uint8_t *in, size_t in_length, char *out);
+EXPORT_DECL ssize_t unhex_len(const char *in, size_t in_length, uint8_t *out);
+EXPORT_DECL size_t hexify(const uint8_t *in, size_t in_length, char *out);
 EXPORT_DECL ssize_t gsm7_encode(const uint16_t *in, size_t in_length, uint16_t *out);
+EXPORT_DECL ssize_t gsm7_encode_ext(const uint16_t *in, size_t in_length, uint16_t *out, uint8_t ls, uint8_t ss);
+EXPORT_DECL int gsm7_tables_septets(const uint16_t *in, size_t in_length, int septets[GSM7_NATIONAL_TABLES][GSM7_NATIONAL_TABLES]);
 EXPORT_DECL ssize_t gsm7_pack(const uint16_t *in, size_t in_length, char *out, size_t out_size, unsigned out_padding);
 EXPORT_DECL ssize_t gsm7_unpack_decode(const char *in, size_t in_length, uint16_t *out, size_t out_size, unsigned in_padding, uint8_t ls, uint8_t ss);
 
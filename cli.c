@@ -48,6 +48,7 @@ static char* complete_device (const char* word, int state)
 static char* cli_show_devices (struct ast_cli_entry* e, int cmd, struct ast_cli_args* a)
 {
 	struct pvt* pvt;
+	struct pvt_status status;
 
 #define FORMAT1 "%-12.12s %-5.5s %-10.10s %-4.4s %-4.4s %-7.7s %-14.14s %-10.10s %-17.17s %-16.16s %-16.16s %-14.14s\n"
 #define FORMAT2 "%-12.12s %-5d %-10.10s %-4d %-4d %-7d %-14.14s %-10.10s %-17.17s %-16.16s %-16.16s %-14.14s\n"
@@ -74,22 +75,22 @@ static char* cli_show_devices (struct ast_cli_entry* e, int cmd, struct ast_cli_
 	AST_RWLIST_RDLOCK (&gpublic->devices);
 	AST_RWLIST_TRAVERSE (&gpublic->devices, pvt, entry)
 	{
-		ast_mutex_lock (&pvt->lock);
+		/* snapshot, don't wait for device busy with AT commands */
+		pvt_status_get (pvt, &status);
 		ast_cli (a->fd, FORMAT2,
 			PVT_ID(pvt),
-			CONF_SHARED(pvt, group),
-			pvt_str_state(pvt),
-			pvt->rssi,
-			pvt->linkmode,
-			pvt->linksubmode,
-			pvt->provider_name,
-			pvt->model,
-			pvt->firmware,
-			pvt->imei,
-			pvt->imsi,
-			pvt->subscriber_number
+			status.group,
+			status.state,
+			status.rssi,
+			status.linkmode,
+			status.linksubmode,
+			status.provider_name,
+			status.model,
+			status.firmware,
+			status.imei,
+			status.imsi,
+			status.subscriber_number
 		);
-		ast_mutex_unlock (&pvt->lock);
 	}
 	AST_RWLIST_UNLOCK (&gpublic->devices);
 
@@ -166,7 +167,7 @@ static char* cli_show_device_settings (struct ast_cli_entry* e, int cmd, struct
 static char* cli_show_device_state (struct ast_cli_entry* e, int cmd, struct ast_cli_args* a)
 {
 	struct pvt* pvt;
-	struct ast_str * statebuf;
+	struct pvt_snapshot snap;
 	char buf[40];
 
 	switch (cmd)
@@ -193,51 +194,50 @@ static char* cli_show_device_state (struct ast_cli_entry* e, int cmd, struct ast
 	pvt = find_device (a->argv[4]);
 	if (pvt)
 	{
-		statebuf = pvt_str_state_ex(pvt);
+		/* print without device lock, console may be slow */
+		pvt_snapshot_fill(pvt, &snap);
+		ast_mutex_unlock (&pvt->lock);
 
 		ast_cli (a->fd, "-------------- Status -------------\n");
-		ast_cli (a->fd, "  Device                  : %s\n", PVT_ID(pvt));
-		ast_cli (a->fd, "  State                   : %s\n", ast_str_buffer(statebuf));
-                if (strcmp(CONF_UNIQ(pvt, quec_uac),"1") == 0) ast_cli (a->fd, "  Audio UAC               : %s\n", CONF_UNIQ(pvt, alsadev));
-		else ast_cli (a->fd, "  Audio                   : %s\n", PVT_STATE(pvt, audio_tty));
-		ast_cli (a->fd, "  Data                    : %s\n", PVT_STATE(pvt, data_tty));
-		ast_cli (a->fd, "  Voice                   : %s\n", (pvt->has_voice) ? "Yes" : "No");
-		ast_cli (a->fd, "  SMS                     : %s\n", (pvt->has_sms) ? "Yes" : "No");
-		ast_cli (a->fd, "  Manufacturer            : %s\n", pvt->manufacturer);
-		ast_cli (a->fd, "  Model                   : %s\n", pvt->model);
-		ast_cli (a->fd, "  Firmware                : %s\n", pvt->firmware);
-		ast_cli (a->fd, "  IMEI                    : %s\n", pvt->imei);
-		ast_cli (a->fd, "  IMSI                    : %s\n", pvt->imsi);
-		ast_cli (a->fd, "  GSM Registration Status : %s\n", GSM_regstate2str(pvt->gsm_reg_status));
-		ast_cli (a->fd, "  RSSI                    : %d, %s\n", pvt->rssi, rssi2dBm(pvt->rssi, buf, sizeof(buf)));
-		ast_cli (a->fd, "  Mode                    : %s\n", sys_mode2str(pvt->linkmode));
-		ast_cli (a->fd, "  Submode                 : %s\n", sys_submode2str(pvt->linksubmode));
-		ast_cli (a->fd, "  Provider Name           : %s\n", pvt->provider_name);
-		ast_cli (a->fd, "  Location area code      : %s\n", pvt->location_area_code);
-		ast_cli (a->fd, "  Cell ID                 : %s\n", pvt->cell_id);
-		ast_cli (a->fd, "  Subscriber Number       : %s\n", pvt->subscriber_number);
-		ast_cli (a->fd, "  SMS Service Center      : %s\n", pvt->sms_scenter);
-		ast_cli (a->fd, "  Use UCS-2 encoding      : %s\n", pvt->use_ucs2_encoding ? "Yes" : "No");
-		ast_cli (a->fd, "  Tasks in queue          : %u\n", PVT_STATE(pvt, at_tasks));
-		ast_cli (a->fd, "  Commands in queue       : %u\n", PVT_STATE(pvt, at_cmds));
-		ast_cli (a->fd, "  Call Waiting            : %s\n", pvt->has_call_waiting ? "Enabled" : "Disabled" );
-		ast_cli (a->fd, "  Current device state    : %s\n", dev_state2str(pvt->current_state) );
-		ast_cli (a->fd, "  Desired device state    : %s\n", dev_state2str(pvt->desired_state) );
-		ast_cli (a->fd, "  When change state       : %s\n", restate2str_msg(pvt->restart_time) );
-
-		ast_cli (a->fd, "  Calls/Channels          : %u\n", PVT_STATE(pvt, chansno));
-		ast_cli (a->fd, "    Active                : %u\n", PVT_STATE(pvt, chan_count[CALL_STATE_ACTIVE]));
-		ast_cli (a->fd, "    Held                  : %u\n", PVT_STATE(pvt, chan_count[CALL_STATE_ONHOLD]));
-		ast_cli (a->fd, "    Dialing               : %u\n", PVT_STATE(pvt, chan_count[CALL_STATE_DIALING]));
-		ast_cli (a->fd, "    Alerting              : %u\n", PVT_STATE(pvt, chan_count[CALL_STATE_ALERTING]));
-		ast_cli (a->fd, "    Incoming              : %u\n", PVT_STATE(pvt, chan_count[CALL_STATE_INCOMING]));
-		ast_cli (a->fd, "    Waiting               : %u\n", PVT_STATE(pvt, chan_count[CALL_STATE_WAITING]));
-		ast_cli (a->fd, "    Releasing             : %u\n", PVT_STATE(pvt, chan_count[CALL_STATE_RELEASED]));
-		ast_cli (a->fd, "    Initializing          : %u\n\n", PVT_STATE(pvt, chan_count[CALL_STATE_INIT]));
+		ast_cli (a->fd, "  Device                  : %s\n", UCONFIG(&snap.settings, id));
+		ast_cli (a->fd, "  State                   : %s\n", snap.str_state_ex);
+                if (strcmp(UCONFIG(&snap.settings, quec_uac),"1") == 0) ast_cli (a->fd, "  Audio UAC               : %s\n", UCONFIG(&snap.settings, alsadev));
+		else ast_cli (a->fd, "  Audio                   : %s\n", PVT_STATE_T(&snap.state, audio_tty));
+		ast_cli (a->fd, "  Data                    : %s\n", PVT_STATE_T(&snap.state, data_tty));
+		ast_cli (a->fd, "  Voice                   : %s\n", (snap.has_voice) ? "Yes" : "No");
+		ast_cli (a->fd, "  SMS                     : %s\n", (snap.has_sms) ? "Yes" : "No");
+		ast_cli (a->fd, "  Manufacturer            : %s\n", snap.manufacturer);
+		ast_cli (a->fd, "  Model                   : %s\n", snap.model);
+		ast_cli (a->fd, "  Firmware                : %s\n", snap.firmware);
+		ast_cli (a->fd, "  IMEI                    : %s\n", snap.imei);
+		ast_cli (a->fd, "  IMSI                    : %s\n", snap.imsi);
+		ast_cli (a->fd, "  GSM Registration Status : %s\n", GSM_regstate2str(snap.gsm_reg_status));
+		ast_cli (a->fd, "  RSSI                    : %d, %s\n", snap.rssi, rssi2dBm(snap.rssi, buf, sizeof(buf)));
+		ast_cli (a->fd, "  Mode                    : %s\n", sys_mode2str(snap.linkmode));
+		ast_cli (a->fd, "  Submode                 : %s\n", sys_submode2str(snap.linksubmode));
+		ast_cli (a->fd, "  Provider Name           : %s\n", snap.provider_name);
+		ast_cli (a->fd, "  Location area code      : %s\n", snap.location_area_code);
+		ast_cli (a->fd, "  Cell ID                 : %s\n", snap.cell_id);
+		ast_cli (a->fd, "  Subscriber Number       : %s\n", snap.subscriber_number);
+		ast_cli (a->fd, "  SMS Service Center      : %s\n", snap.sms_scenter);
+		ast_cli (a->fd, "  Use UCS-2 encoding      : %s\n", snap.use_ucs2_encoding ? "Yes" : "No");
+		ast_cli (a->fd, "  Tasks in queue          : %u\n", PVT_STATE_T(&snap.state, at_tasks));
+		ast_cli (a->fd, "  Commands in queue       : %u\n", PVT_STATE_T(&snap.state, at_cmds));
+		ast_cli (a->fd, "  Call Waiting            : %s\n", snap.has_call_waiting ? "Enabled" : "Disabled" );
+		ast_cli (a->fd, "  Current device state    : %s\n", dev_state2str(snap.current_state) );
+		ast_cli (a->fd, "  Desired device state    : %s\n", dev_state2str(snap.desired_state) );
+		ast_cli (a->fd, "  When change state       : %s\n", restate2str_msg(snap.restart_time) );
+
+		ast_cli (a->fd, "  Calls/Channels          : %u\n", PVT_STATE_T(&snap.state, chansno));
+		ast_cli (a->fd, "    Active                : %u\n", PVT_STATE_T(&snap.state, chan_count[CALL_STATE_ACTIVE]));
+		ast_cli (a->fd, "    Held                  : %u\n", PVT_STATE_T(&snap.state, chan_count[CALL_STATE_ONHOLD]));
+		ast_cli (a->fd, "    Dialing               : %u\n", PVT_STATE_T(&snap.state, chan_count[CALL_STATE_DIALING]));
+		ast_cli (a->fd, "    Alerting              : %u\n", PVT_STATE_T(&snap.state, chan_count[CALL_STATE_ALERTING]));
+		ast_cli (a->fd, "    Incoming              : %u\n", PVT_STATE_T(&snap.state, chan_count[CALL_STATE_INCOMING]));
+		ast_cli (a->fd, "    Waiting               : %u\n", PVT_STATE_T(&snap.state, chan_count[CALL_STATE_WAITING]));
+		ast_cli (a->fd, "    Releasing             : %u\n", PVT_STATE_T(&snap.state, chan_count[CALL_STATE_RELEASED]));
+		ast_cli (a->fd, "    Initializing          : %u\n\n", PVT_STATE_T(&snap.state, chan_count[CALL_STATE_INIT]));
 /* TODO: show call waiting  network setting and local config value */
-		ast_mutex_unlock (&pvt->lock);
-
-		ast_free(statebuf);
 	}
 	else
 	{
@@ -248,7 +248,7 @@ static char* cli_show_device_state (struct ast_cli_entry* e, int cmd, struct ast
 }
 
 #/* */
-static int32_t getACD(uint32_t calls, uint32_t duration)
+static int32_t getACD(uint64_t calls, uint64_t duration)
 {
 	int32_t acd;
 
@@ -262,7 +262,7 @@ static int32_t getACD(uint32_t calls, uint32_t duration)
 }
 
 #/* */
-static int32_t getASR(uint32_t total, uint32_t handled)
+static int32_t getASR(uint64_t total, uint64_t handled)
 {
 	int32_t asr;
 	if(total) {
@@ -274,9 +274,25 @@ static int32_t getASR(uint32_t total, uint32_t handled)
 	return asr;
 }
 
+#/* */
+static void cli_show_hist (int fd, const char * title, const struct histogram * hist)
+{
+	ast_cli (fd, "  %-28s: count %llu avg %llu p50 %llu p90 %llu p99 %llu max %llu\n",
+		title,
+		(unsigned long long int) hist->count,
+		(unsigned long long int) (hist->count ? hist->sum / hist->count : 0),
+		(unsigned long long int) hist_percentile (hist, 50),
+		(unsigned long long int) hist_percentile (hist, 90),
+		(unsigned long long int) hist_percentile (hist, 99),
+		(unsigned long long int) hist->max);
+}
+
 static char* cli_show_device_statistics (struct ast_cli_entry* e, int cmd, struct ast_cli_args* a)
 {
 	struct pvt * pvt;
+	pvt_stat_t * stat;
+	struct histogram at_latency;
+	unsigned i;
 
 	switch (cmd)
 	{
@@ -299,67 +315,159 @@ static char* cli_show_device_statistics (struct ast_cli_entry* e, int cmd, struc
 		return CLI_SHOWUSAGE;
 	}
 
+	stat = ast_malloc (sizeof (*stat));
+	if (!stat)
+	{
+		return CLI_FAILURE;
+	}
+
 	pvt = find_device (a->argv[4]);
 	if (pvt)
 	{
+		/* print from copy, counters are updated without lock */
+		pvt_stat_get (pvt, stat);
+		ast_mutex_unlock (&pvt->lock);
+
+		memset (&at_latency, 0, sizeof (at_latency));
+		for (i = 0; i < AT_CMDS_NUMBER; i++)
+		{
+			hist_merge (&at_latency, &stat->at_latency[i]);
+		}
+
 		ast_cli (a->fd, "-------------- Statistics -------------\n");
-		ast_cli (a->fd, "  Device                      : %s\n", PVT_ID(pvt));
-		ast_cli (a->fd, "  Queue tasks                 : %u\n", PVT_STAT(pvt, at_tasks));
-		ast_cli (a->fd, "  Queue commands              : %u\n", PVT_STAT(pvt, at_cmds));
-		ast_cli (a->fd, "  Responses                   : %u\n", PVT_STAT(pvt, at_responses));
-		ast_cli (a->fd, "  Bytes of read responses     : %u\n", PVT_STAT(pvt, d_read_bytes));
-		ast_cli (a->fd, "  Bytes of written commands   : %u\n", PVT_STAT(pvt, d_write_bytes));
-		ast_cli (a->fd, "  Bytes of read audio         : %llu\n", (unsigned long long int)PVT_STAT(pvt, a_read_bytes));
-		ast_cli (a->fd, "  Bytes of written audio      : %llu\n", (unsigned long long int)PVT_STAT(pvt, a_write_bytes));
-		ast_cli (a->fd, "  Readed frames               : %u\n", PVT_STAT(pvt, read_frames));
-		ast_cli (a->fd, "  Readed short frames         : %u\n", PVT_STAT(pvt, read_sframes));
-		ast_cli (a->fd, "  Wrote frames                : %u\n", PVT_STAT(pvt, write_frames));
-		ast_cli (a->fd, "  Wrote short frames          : %u\n", PVT_STAT(pvt, write_tframes));
-		ast_cli (a->fd, "  Wrote silence frames        : %u\n", PVT_STAT(pvt, write_sframes));
-		ast_cli (a->fd, "  Write buffer overflow bytes : %llu\n", (unsigned long long int)PVT_STAT(pvt, write_rb_overflow_bytes));
-		ast_cli (a->fd, "  Write buffer overflow count : %u\n", PVT_STAT(pvt, write_rb_overflow));
-		ast_cli (a->fd, "  Incoming calls              : %u\n", PVT_STAT(pvt, in_calls));
-		ast_cli (a->fd, "  Waiting calls               : %u\n", PVT_STAT(pvt, cw_calls));
-		ast_cli (a->fd, "  Handled input calls         : %u\n", PVT_STAT(pvt, in_calls_handled));
-		ast_cli (a->fd, "  Fails to PBX run            : %u\n", PVT_STAT(pvt, in_pbx_fails));
-		ast_cli (a->fd, "  Attempts to outgoing calls  : %u\n", PVT_STAT(pvt, out_calls));
-		ast_cli (a->fd, "  Answered outgoing calls     : %u\n", PVT_STAT(pvt, calls_answered[CALL_DIR_OUTGOING]));
-		ast_cli (a->fd, "  Answered incoming calls     : %u\n", PVT_STAT(pvt, calls_answered[CALL_DIR_INCOMING]));
-		ast_cli (a->fd, "  Seconds of outgoing calls   : %u\n", PVT_STAT(pvt, calls_duration[CALL_DIR_OUTGOING]));
-		ast_cli (a->fd, "  Seconds of incoming calls   : %u\n", PVT_STAT(pvt, calls_duration[CALL_DIR_INCOMING]));
-		ast_cli (a->fd, "  ACD for incoming calls      : %d\n", getACD(PVT_STAT(pvt, calls_answered[CALL_DIR_INCOMING]), PVT_STAT(pvt, calls_duration[CALL_DIR_INCOMING])));
-		ast_cli (a->fd, "  ACD for outgoing calls      : %d\n", getACD(PVT_STAT(pvt, calls_answered[CALL_DIR_OUTGOING]), PVT_STAT(pvt, calls_duration[CALL_DIR_OUTGOING])));
+		ast_cli (a->fd, "  Device                      : %s\n", a->argv[4]);
+		ast_cli (a->fd, "  Queue tasks                 : %llu\n", (unsigned long long int)PVT_STAT_T(stat, at_tasks));
+		ast_cli (a->fd, "  Queue commands              : %llu\n", (unsigned long long int)PVT_STAT_T(stat, at_cmds));
+		ast_cli (a->fd, "  Responses                   : %llu\n", (unsigned long long int)PVT_STAT_T(stat, at_responses));
+		ast_cli (a->fd, "  Bytes of read responses     : %llu\n", (unsigned long long int)PVT_STAT_T(stat, d_read_bytes));
+		ast_cli (a->fd, "  Bytes of written commands   : %llu\n", (unsigned long long int)PVT_STAT_T(stat, d_write_bytes));
+		ast_cli (a->fd, "  Bytes of read audio         : %llu\n", (unsigned long long int)PVT_STAT_T(stat, a_read_bytes));
+		ast_cli (a->fd, "  Bytes of written audio      : %llu\n", (unsigned long long int)PVT_STAT_T(stat, a_write_bytes));
+		ast_cli (a->fd, "  Readed frames               : %llu\n", (unsigned long long int)PVT_STAT_T(stat, read_frames));
+		ast_cli (a->fd, "  Readed short frames         : %llu\n", (unsigned long long int)PVT_STAT_T(stat, read_sframes));
+		ast_cli (a->fd, "  Wrote frames                : %llu\n", (unsigned long long int)PVT_STAT_T(stat, write_frames));
+		ast_cli (a->fd, "  Wrote short frames          : %llu\n", (unsigned long long int)PVT_STAT_T(stat, write_tframes));
+		ast_cli (a->fd, "  Wrote silence frames        : %llu\n", (unsigned long long int)PVT_STAT_T(stat, write_sframes));
+		ast_cli (a->fd, "  Write buffer overflow bytes : %llu\n", (unsigned long long int)PVT_STAT_T(stat, write_rb_overflow_bytes));
+		ast_cli (a->fd, "  Write buffer overflow count : %llu\n", (unsigned long long int)PVT_STAT_T(stat, write_rb_overflow));
+		ast_cli (a->fd, "  Incoming calls              : %llu\n", (unsigned long long int)PVT_STAT_T(stat, in_calls));
+		ast_cli (a->fd, "  Waiting calls               : %llu\n", (unsigned long long int)PVT_STAT_T(stat, cw_calls));
+		ast_cli (a->fd, "  Handled input calls         : %llu\n", (unsigned long long int)PVT_STAT_T(stat, in_calls_handled));
+		ast_cli (a->fd, "  Fails to PBX run            : %llu\n", (unsigned long long int)PVT_STAT_T(stat, in_pbx_fails));
+		ast_cli (a->fd, "  Attempts to outgoing calls  : %llu\n", (unsigned long long int)PVT_STAT_T(stat, out_calls));
+		ast_cli (a->fd, "  Answered outgoing calls     : %llu\n", (unsigned long long int)PVT_STAT_T(stat, calls_answered[CALL_DIR_OUTGOING]));
+		ast_cli (a->fd, "  Answered incoming calls     : %llu\n", (unsigned long long int)PVT_STAT_T(stat, calls_answered[CALL_DIR_INCOMING]));
+		ast_cli (a->fd, "  Seconds of outgoing calls   : %llu\n", (unsigned long long int)PVT_STAT_T(stat, calls_duration[CALL_DIR_OUTGOING]));
+		ast_cli (a->fd, "  Seconds of incoming calls   : %llu\n", (unsigned long long int)PVT_STAT_T(stat, calls_duration[CALL_DIR_INCOMING]));
+		ast_cli (a->fd, "  ACD for incoming calls      : %d\n", getACD(PVT_STAT_T(stat, calls_answered[CALL_DIR_INCOMING]), PVT_STAT_T(stat, calls_duration[CALL_DIR_INCOMING])));
+		ast_cli (a->fd, "  ACD for outgoing calls      : %d\n", getACD(PVT_STAT_T(stat, calls_answered[CALL_DIR_OUTGOING]), PVT_STAT_T(stat, calls_duration[CALL_DIR_OUTGOING])));
 /*
 		ast_cli (a->fd, "  ACD                         : %d\n",
 			getACD(
-				PVT_STAT(pvt, calls_answered[CALL_DIR_OUTGOING])
-				+ PVT_STAT(pvt, calls_answered[CALL_DIR_INCOMING]),
+				PVT_STAT_T(stat, calls_answered[CALL_DIR_OUTGOING])
+				+ PVT_STAT_T(stat, calls_answered[CALL_DIR_INCOMING]),
 
-				PVT_STAT(pvt, calls_duration[CALL_DIR_OUTGOING])
-				+ PVT_STAT(pvt, calls_duration[CALL_DIR_INCOMING])
+				PVT_STAT_T(stat, calls_duration[CALL_DIR_OUTGOING])
+				+ PVT_STAT_T(stat, calls_duration[CALL_DIR_INCOMING])
 				)
 			);
 */
-		ast_cli (a->fd, "  ASR for incoming calls      : %d\n", getASR(PVT_STAT(pvt, in_calls) + PVT_STAT(pvt, cw_calls), PVT_STAT(pvt, calls_answered[CALL_DIR_INCOMING])) );
-		ast_cli (a->fd, "  ASR for outgoing calls      : %d\n\n", getASR(PVT_STAT(pvt, out_calls), PVT_STAT(pvt, calls_answered[CALL_DIR_OUTGOING])));
+		ast_cli (a->fd, "  ASR for incoming calls      : %d\n", getASR(PVT_STAT_T(stat, in_calls) + PVT_STAT_T(stat, cw_calls), PVT_STAT_T(stat, calls_answered[CALL_DIR_INCOMING])) );
+		ast_cli (a->fd, "  ASR for outgoing calls      : %d\n", getASR(PVT_STAT_T(stat, out_calls), PVT_STAT_T(stat, calls_answered[CALL_DIR_OUTGOING])));
 /*
 		ast_cli (a->fd, "  ASR                         : %d\n\n",
 			getASR(
-				PVT_STAT(pvt, out_calls)
-				+ PVT_STAT(pvt, in_calls)
-				+ PVT_STAT(pvt, cw_calls),
+				PVT_STAT_T(stat, out_calls)
+				+ PVT_STAT_T(stat, in_calls)
+				+ PVT_STAT_T(stat, cw_calls),
 
-				PVT_STAT(pvt, calls_answered[CALL_DIR_OUTGOING])
-				+ PVT_STAT(pvt, calls_answered[CALL_DIR_INCOMING])
+				PVT_STAT_T(stat, calls_answered[CALL_DIR_OUTGOING])
+				+ PVT_STAT_T(stat, calls_answered[CALL_DIR_INCOMING])
 				)
 			);
 */
+		cli_show_hist (a->fd, "AT round trip, us", &at_latency);
+		cli_show_hist (a->fd, "Audio read jitter, us", &stat->a_read_jitter);
+		cli_show_hist (a->fd, "Audio write jitter, us", &stat->a_write_jitter);
+		cli_show_hist (a->fd, "Device lock held, us", &stat->lock_hold);
+		ast_cli (a->fd, "\n");
+	}
+	else
+	{
+		ast_cli (a->fd, "Device %s not found\n", a->argv[4]);
+	}
+	ast_free (stat);
+
+	return CLI_SUCCESS;
+}
+
+static char* cli_show_device_latency (struct ast_cli_entry* e, int cmd, struct ast_cli_args* a)
+{
+	struct pvt * pvt;
+	pvt_stat_t * stat;
+	const struct histogram * hist;
+	unsigned i;
+
+	switch (cmd)
+	{
+		case CLI_INIT:
+			e->command =	"quectel show device latency";
+			e->usage   =	"Usage: quectel show device latency <device>\n"
+					"       Shows round trip in microseconds and failures of each AT command sent to Quectel device.\n";
+			return NULL;
+
+		case CLI_GENERATE:
+			if (a->pos == 4)
+			{
+				return complete_device (a->word, a->n);
+			}
+			return NULL;
+	}
+
+	if (a->argc != 5)
+	{
+		return CLI_SHOWUSAGE;
+	}
+
+	stat = ast_malloc (sizeof (*stat));
+	if (!stat)
+	{
+		return CLI_FAILURE;
+	}
+
+	pvt = find_device (a->argv[4]);
+	if (pvt)
+	{
+		pvt_stat_get (pvt, stat);
 		ast_mutex_unlock (&pvt->lock);
+
+		ast_cli (a->fd, "%-16s %8s %8s %8s %8s %8s %8s %8s %8s %8s\n",
+			"Command", "Count", "Avg", "P50", "P90", "P99", "Max", "Timeouts", "Errors", "CMSErr");
+		for (i = 0; i < AT_CMDS_NUMBER; i++)
+		{
+			hist = &stat->at_latency[i];
+			if (hist->count == 0 && stat->at_timeouts[i] == 0 && stat->at_errors[i] == 0 && stat->at_cms_errors[i] == 0)
+			{
+				continue;
+			}
+			ast_cli (a->fd, "%-16s %8llu %8llu %8llu %8llu %8llu %8llu %8llu %8llu %8llu\n",
+				at_cmd2str (i),
+				(unsigned long long int) hist->count,
+				(unsigned long long int) (hist->count ? hist->sum / hist->count : 0),
+				(unsigned long long int) hist_percentile (hist, 50),
+				(unsigned long long int) hist_percentile (hist, 90),
+				(unsigned long long int) hist_percentile (hist, 99),
+				(unsigned long long int) hist->max,
+				(unsigned long long int) stat->at_timeouts[i],
+				(unsigned long long int) stat->at_errors[i],
+				(unsigned long long int) stat->at_cms_errors[i]);
+		}
 	}
 	else
 	{
 		ast_cli (a->fd, "Device %s not found\n", a->argv[4]);
 	}
+	ast_free (stat);
 
 	return CLI_SUCCESS;
 }
@@ -464,7 +572,9 @@ static char* cli_sms (struct ast_cli_entry* e, int cmd, struct ast_cli_args* a)
 			e->command = "quectel sms";
 			e->usage =
 				"Usage: quectel sms <device> <number> <message>\n"
-				"       Send a SMS to <number> with the <message> from <device>\n";
+				"       Send a SMS to <number> with the <message> from <device>\n"
+				"       <device> may be g<N>, r<N>, p:<provider>, s:<imsi prefix> or i:<imei>\n"
+				"       to use the ready device with the shortest queue\n";
 			return NULL;
 
 		case CLI_GENERATE:
@@ -493,9 +603,10 @@ static char* cli_sms (struct ast_cli_entry* e, int cmd, struct ast_cli_args* a)
 		}
 	}
 
-	int res = send_sms(a->argv[2], a->argv[3], ast_str_buffer(buf), 0, "1", "UNKNOWN", 8);
+	char used[DEVNAMELEN];
+	int res = send_sms(a->argv[2], a->argv[3], ast_str_buffer(buf), 0, "1", "UNKNOWN", 8, used);
 	ast_free (buf);
-	ast_cli(a->fd, "[%s] %s\n", a->argv[2], res < 0 ? error2str(chan_quectel_err) : "SMS queued for send");
+	ast_cli(a->fd, "[%s] %s\n", res < 0 ? a->argv[2] : used, res < 0 ? error2str(chan_quectel_err) : "SMS queued for send");
 
 	return CLI_SUCCESS;
 }
@@ -839,7 +950,7 @@ static char * cli_discovery(struct ast_cli_entry * e, int cmd, struct ast_cli_ar
 
 			ast_cli(a->fd, "; discovered device\n");
 			ast_cli(a->fd, "[dc_%s_%s](defaults)\n", imei + imeilen - MIN(imeilen,4), imsi + imsilen - MIN(imsilen,4));
-			ast_cli(a->fd, ";audio=%s\n", res->ports.ports[INTERFACE_TYPE_VOICE]);
+			ast_cli(a->fd, ";audio=%s\n", S_OR(res->ports.ports[INTERFACE_TYPE_VOICE], ""));
 			ast_cli(a->fd, ";data=%s\n", res->ports.ports[INTERFACE_TYPE_DATA]);
 			ast_cli(a->fd, "imei=%s\n", imei);
 			ast_cli(a->fd, "imsi=%s\n\n", imsi);
@@ -858,6 +969,7 @@ static struct ast_cli_entry cli[] = {
 	AST_CLI_DEFINE (cli_show_device_settings,"Show Quectel device settings"),
 	AST_CLI_DEFINE (cli_show_device_state,	 "Show Quectel device state"),
 	AST_CLI_DEFINE (cli_show_device_statistics,"Show Quectel device statistics"),
+	AST_CLI_DEFINE (cli_show_device_latency,"Show Quectel device AT command latency"),
 	AST_CLI_DEFINE (cli_show_version,	"Show module version"),
 	AST_CLI_DEFINE (cli_cmd,		"Send commands to port for debugging"),
 	AST_CLI_DEFINE (cli_ussd,		"Send USSD commands to the quectel"),
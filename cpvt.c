@@ -57,11 +57,14 @@ EXPORT_DEF struct cpvt * cpvt_alloc(struct pvt * pvt, int call_idx, unsigned dir
 
 //			rb_init (&cpvt->a_write_rb, cpvt->a_write_buf, sizeof (cpvt->a_write_buf));
 
+			ast_mutex_lock (&pvt->a_lock);
 			AST_LIST_INSERT_TAIL(&pvt->chans, cpvt, entry);
+			ast_mutex_unlock (&pvt->a_lock);
 			if(PVT_NO_CHANS(pvt))
 				pvt_on_create_1st_channel(pvt);
 			PVT_STATE(pvt, chansno)++;
 			PVT_STATE(pvt, chan_count[cpvt->state])++;
+			pvt_status_publish(pvt);
 
 
 
@@ -82,11 +85,10 @@ EXPORT_DEF void cpvt_free(struct cpvt* cpvt)
 	struct cpvt * found;
 	struct at_queue_task * task;
 
-	close(cpvt->rd_pipe[1]);
-	close(cpvt->rd_pipe[0]);
-
-
 	ast_debug (3, "[%s] destroy cpvt for call_idx %d dir %d state '%s' flags %d has%s channel\n",  PVT_ID(pvt), cpvt->call_idx, cpvt->dir, call_state2str(cpvt->state), cpvt->flags, cpvt->channel ? "" : "'t");
+
+	/* audio paths walk chans and use cpvt under a_lock only */
+	ast_mutex_lock (&pvt->a_lock);
 	AST_LIST_TRAVERSE_SAFE_BEGIN(&pvt->chans, found, entry) {
 		if(found == cpvt)
 		{
@@ -97,6 +99,10 @@ EXPORT_DEF void cpvt_free(struct cpvt* cpvt)
 		}
 	}
 	AST_LIST_TRAVERSE_SAFE_END;
+	ast_mutex_unlock (&pvt->a_lock);
+
+	close(cpvt->rd_pipe[1]);
+	close(cpvt->rd_pipe[0]);
 
 	/* relink task to sys_chan */
 	AST_LIST_TRAVERSE(&pvt->at_queue, task, entry) {
@@ -113,6 +119,7 @@ EXPORT_DEF void cpvt_free(struct cpvt* cpvt)
 		pvt_on_remove_last_channel(pvt);
 		pvt_try_restate(pvt);
 		}
+	pvt_status_publish(pvt);
 
 	ast_free(cpvt);
 }
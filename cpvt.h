@@ -14,6 +14,7 @@
 #include "mutils.h"				/* enum2str() ITEMS_OF() */
 #define FRAME_SIZE		320
 #define FRAME_SIZE2		160
+#define FRAME_DURATION_US	20000			/* time of FRAME_SIZE bytes of 8kHz 16bit audio */
 
 typedef enum {
 	CALL_STATE_MIN		= 0,
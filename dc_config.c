@@ -104,6 +104,8 @@ EXPORT_DEF void dc_sconfig_fill_defaults(struct dc_sconfig * config)
 	config->mindtmfgap		= DEFAULT_MINDTMFGAP;
 	config->mindtmfduration		= DEFAULT_MINDTMFDURATION;
 	config->mindtmfinterval		= DEFAULT_MINDTMFINTERVAL;
+	config->smsretries		= DEFAULT_SMSRETRIES;
+	config->smsretrydelay		= DEFAULT_SMSRETRYDELAY;
 }
 
 #/* */
@@ -231,9 +233,86 @@ EXPORT_DEF void dc_sconfig_fill(struct ast_config * cfg, const char * cat, struc
 				config->mindtmfduration = DEFAULT_MINDTMFINTERVAL;
 			}
 		}
+		else if (!strcasecmp (v->name, "smsrate"))
+		{
+			errno = 0;
+			config->smsrate = (int) strtol (v->value, (char**) NULL, 10);
+			if ((config->smsrate == 0 && errno == EINVAL) || config->smsrate < 0)
+			{
+				ast_log(LOG_ERROR, "Invalid value for 'smsrate' '%s', setting default 0\n", v->value);
+				config->smsrate = 0;
+			}
+		}
+		else if (!strcasecmp (v->name, "smsretries"))
+		{
+			errno = 0;
+			config->smsretries = (int) strtol (v->value, (char**) NULL, 10);
+			if ((config->smsretries == 0 && errno == EINVAL) || config->smsretries < 0)
+			{
+				ast_log(LOG_ERROR, "Invalid value for 'smsretries' '%s', setting default %d\n", v->value, DEFAULT_SMSRETRIES);
+				config->smsretries = DEFAULT_SMSRETRIES;
+			}
+		}
+		else if (!strcasecmp (v->name, "smsretrydelay"))
+		{
+			errno = 0;
+			config->smsretrydelay = (int) strtol (v->value, (char**) NULL, 10);
+			if ((config->smsretrydelay == 0 && errno == EINVAL) || config->smsretrydelay <= 0)
+			{
+				ast_log(LOG_ERROR, "Invalid value for 'smsretrydelay' '%s', setting default %d\n", v->value, DEFAULT_SMSRETRYDELAY);
+				config->smsretrydelay = DEFAULT_SMSRETRYDELAY;
+			}
+		}
 	}
 }
 
+/*!
+ * \brief Parse comma separated classes of AMI events
+ * \param value -- e.g. "sms,call,status", "all" or "none"
+ * \return mask of AMI_EVENT_*
+ */
+#/* */
+static unsigned dc_ami_events_parse(const char * value)
+{
+	static const struct {
+		const char *	name;
+		unsigned	mask;
+	} classes[] = {
+		{ "sms", AMI_EVENT_SMS },
+		{ "raw", AMI_EVENT_RAW },
+		{ "ussd", AMI_EVENT_USSD },
+		{ "call", AMI_EVENT_CALL },
+		{ "status", AMI_EVENT_STATUS },
+		{ "signal", AMI_EVENT_SIGNAL },
+		{ "report", AMI_EVENT_REPORT },
+		{ "port", AMI_EVENT_PORT },
+		{ "all", AMI_EVENT_ALL },
+		{ "none", 0 },
+	};
+	char * list = ast_strdupa(value);
+	char * name;
+	unsigned mask = 0;
+	unsigned i;
+
+	while ((name = strsep(&list, ",")))
+	{
+		name = ast_strip(name);
+		if (!*name)
+			continue;
+		for (i = 0; i < ITEMS_OF(classes); i++)
+		{
+			if (!strcasecmp(name, classes[i].name))
+			{
+				mask |= classes[i].mask;
+				break;
+			}
+		}
+		if (i == ITEMS_OF(classes))
+			ast_log (LOG_NOTICE, "Unknown class '%s' in 'amievents' of general section, ignored\n", name);
+	}
+	return mask;
+}
+
 #/* */
 EXPORT_DEF void dc_gconfig_fill(struct ast_config * cfg, const char * cat, struct dc_gconfig * config)
 {
@@ -246,6 +325,9 @@ EXPORT_DEF void dc_gconfig_fill(struct ast_config * cfg, const char * cat, struc
 	config->discovery_interval = DEFAULT_DISCOVERY_INT;
 	ast_copy_string (config->sms_db, DEFAULT_SMS_DB, sizeof(DEFAULT_SMS_DB));
 	config->csms_ttl = DEFAULT_CSMS_TTL;
+	config->ami_events = DEFAULT_AMI_EVENTS;
+	config->ami_sms_combined = 0;
+	config->ami_coalesce = 0;
 
 	stmp = ast_variable_retrieve (cfg, cat, "interval");
 	if(stmp)
@@ -275,6 +357,32 @@ EXPORT_DEF void dc_gconfig_fill(struct ast_config * cfg, const char * cat, struc
 			config->csms_ttl = tmp;
 	}
 
+	stmp = ast_variable_retrieve (cfg, cat, "amievents");
+	if(stmp)
+	{
+		config->ami_events = dc_ami_events_parse(stmp);
+	}
+
+	stmp = ast_variable_retrieve (cfg, cat, "amismsevent");
+	if(stmp)
+	{
+		if (!strcasecmp(stmp, "combined"))
+			config->ami_sms_combined = 1;
+		else if (strcasecmp(stmp, "separate"))
+			ast_log (LOG_NOTICE, "Error parsing 'amismsevent' in general section, using separate events\n");
+	}
+
+	stmp = ast_variable_retrieve (cfg, cat, "amicoalesce");
+	if(stmp)
+	{
+		errno = 0;
+		tmp = (int) strtol (stmp, (char**) NULL, 10);
+		if ((tmp == 0 && errno == EINVAL) || tmp < 0)
+			ast_log (LOG_NOTICE, "Error parsing 'amicoalesce' in general section, using default value %d\n", config->ami_coalesce);
+		else
+			config->ami_coalesce = tmp;
+	}
+
 	for (v = ast_variable_browse (cfg, cat); v; v = v->next)
 		/* handle jb conf */
 		ast_jb_read_conf (&config->jbconf, v->name, v->value);
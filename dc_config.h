@@ -91,6 +91,12 @@ typedef struct dc_sconfig
 
 	int			mindtmfinterval;		/*!< minimal DTMF interval beetween ends in ms, applied only on same digit */
 #define DEFAULT_MINDTMFINTERVAL	200
+
+	int			smsrate;			/*!< maximal number of spooled SMS messages sent per minute, 0 means unlimited */
+	int			smsretries;			/*!< number of resend attempts of SMS part rejected by device */
+#define DEFAULT_SMSRETRIES	3
+	int			smsretrydelay;			/*!< delay before first resend in seconds, doubled on each attempt */
+#define DEFAULT_SMSRETRYDELAY	30
 } dc_sconfig_t;
 
 /* Global settings */
@@ -103,9 +109,24 @@ typedef struct dc_gconfig
 #define DEFAULT_SMS_DB "/var/lib/asterisk/smsdb"
 	int csms_ttl;
 #define DEFAULT_CSMS_TTL 600
+	unsigned		ami_events;			/*!< AMI_EVENT_* classes of events sent to manager */
+	int			ami_sms_combined;		/*!< one QuectelSMS event instead of raw, text and base64 ones */
+	int			ami_coalesce;			/*!< seconds between QuectelDeviceBatch events, 0 sends status at once */
 
 } dc_gconfig_t;
 
+/* classes of AMI events for 'amievents' */
+#define AMI_EVENT_SMS		0x0001			/*!< received SMS */
+#define AMI_EVENT_RAW		0x0002			/*!< raw +CMT +CMGR +CUSD lines */
+#define AMI_EVENT_USSD		0x0004			/*!< received USSD */
+#define AMI_EVENT_CALL		0x0008			/*!< call state changes and CEND */
+#define AMI_EVENT_STATUS	0x0010			/*!< device status */
+#define AMI_EVENT_SIGNAL	0x0020			/*!< RSSI changes, only with ami_coalesce */
+#define AMI_EVENT_REPORT	0x0040			/*!< SMS delivery reports */
+#define AMI_EVENT_PORT		0x0080			/*!< port failures */
+#define AMI_EVENT_ALL		0x00ff
+#define DEFAULT_AMI_EVENTS	(AMI_EVENT_ALL & ~AMI_EVENT_SIGNAL)
+
 /* Local required (unique) settings */
 typedef struct dc_uconfig
 {
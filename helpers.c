@@ -17,6 +17,7 @@
 #include "helpers.h"
 #include "chan_quectel.h"			/* devices */
 #include "at_command.h"
+#include "smsdb.h"				/* smsdb_batch_begin() smsdb_outgoing_clear() */
 #include "error.h"
 // #include "pdu.h"				/* pdu_digit2code() */
 
@@ -124,8 +125,14 @@ EXPORT_DEF int send_ussd(const char *dev_name, const char *ussd)
 	return res;
 }
 
+/*!
+ * \brief Send SMS message
+ * \param resource -- device name or resource spec (g<N>, r<N>, p:<provider>, s:<imsi prefix>, i:<imei>),
+ *	for spec the ready device with smallest backlog is used
+ * \param device -- if not NULL, buffer of DEVNAMELEN size for name of used device
+ */
 #/* */
-EXPORT_DEF int send_sms(const char *dev_name, const char *number, const char *message, const char *validity, const char *report, const char *payload, size_t payload_len)
+EXPORT_DEF int send_sms(const char *resource, const char *number, const char *message, const char *validity, const char *report, const char *payload, size_t payload_len, char *device)
 {
 	if (!is_valid_phone_number(number)) {
 		chan_quectel_err = E_INVALID_PHONE_NUMBER;
@@ -140,15 +147,198 @@ EXPORT_DEF int send_sms(const char *dev_name, const char *number, const char *me
 
 	int srr = !report ? 0 : ast_true(report);
 	
-	struct pvt *pvt = get_pvt(dev_name, 1);
+	struct pvt *pvt = find_device_for_sms(resource);
 	if (!pvt) {
 		return -1;
 	}
+	if (device) {
+		ast_copy_string(device, PVT_ID(pvt), DEVNAMELEN);
+	}
 	int res = at_enqueue_sms(&pvt->sys_chan, number, message, val, srr, payload, payload_len);
 	free_pvt(pvt);
 	return res;
 }
 
+/* device able to take part of a SMS batch */
+struct sms_batch_dev
+{
+	char		id[DEVNAMELEN];
+	char		imsi[sizeof(((struct pvt*)0)->imsi)];
+	int		group;
+	unsigned	pending;		/*!< spooled and queued messages, include assigned by batch */
+	AST_LIST_HEAD_NOLOCK (, at_sms) sms;
+};
+
+#/* */
+static int sms_batch_dev_add(struct sms_batch_dev **devs, unsigned *ndevs, const struct pvt *pvt)
+{
+	struct sms_batch_dev *tmp = ast_realloc(*devs, (*ndevs + 1) * sizeof(**devs));
+	if (!tmp) {
+		return -1;
+	}
+	*devs = tmp;
+	tmp += (*ndevs)++;
+
+	ast_copy_string(tmp->id, PVT_ID(pvt), sizeof(tmp->id));
+	ast_copy_string(tmp->imsi, pvt->imsi, sizeof(tmp->imsi));
+	tmp->group = CONF_SHARED(pvt, group);
+	tmp->pending = pvt_sms_backlog(pvt);
+	AST_LIST_HEAD_INIT_NOLOCK(&tmp->sms);
+	return 0;
+}
+
+/* collect devices ready for SMS selected by resource, see find_device_for_sms() */
+#/* */
+static int sms_batch_devs(const char *resource, struct sms_batch_dev **devs, unsigned *ndevs)
+{
+	struct pvt *pvt;
+	int exists = 0;
+	int res = 0;
+
+	*devs = NULL;
+	*ndevs = 0;
+
+	AST_RWLIST_RDLOCK(&gpublic->devices);
+	AST_RWLIST_TRAVERSE(&gpublic->devices, pvt, entry) {
+		ast_mutex_lock(&pvt->lock);
+		if (pvt_match_resource(pvt, resource)) {
+			exists = 1;
+			if (ready4sms(pvt)) {
+				res = sms_batch_dev_add(devs, ndevs, pvt);
+			}
+		}
+		ast_mutex_unlock(&pvt->lock);
+		if (res) {
+			break;
+		}
+	}
+	AST_RWLIST_UNLOCK(&gpublic->devices);
+
+	if (res) {
+		chan_quectel_err = E_UNKNOWN;
+		ast_free(*devs);
+		*devs = NULL;
+		*ndevs = 0;
+	} else if (*ndevs == 0) {
+		chan_quectel_err = exists ? E_DEVICE_DISCONNECTED : E_DEVICE_NOT_FOUND;
+		res = -1;
+	}
+	return res;
+}
+
+#/* */
+static void sms_batch_unspool(struct sms_batch_dev *dev)
+{
+	at_sms_t *sms;
+
+	while ((sms = AST_LIST_REMOVE_HEAD(&dev->sms, entry))) {
+		smsdb_outgoing_pdu_unspool(sms->uid, 0);
+		ast_free(sms);
+	}
+}
+
+/*!
+ * \brief Send many SMS messages at once
+ * \param resource -- device name or resource spec as for send_sms(), messages are spread over selected devices
+ * \param items -- messages, result of each message is returned in it
+ * \param count -- number of items
+ * \return number of queued messages, -1 if resource is not usable
+ *
+ * All reference ids and outgoing records are allocated in one smsdb transaction,
+ * the messages are put to the device spool and sent with the smsrate of the device.
+ */
+#/* */
+EXPORT_DEF int send_sms_batch(const char *resource, sms_batch_item_t *items, unsigned count, const char *validity, const char *report)
+{
+	struct sms_batch_dev *devs;
+	unsigned ndevs;
+	unsigned i, d;
+	int queued = 0;
+
+	int val = 0;
+	if (validity) {
+		val = strtol(validity, NULL, 10);
+		val = val <= 0 ? 0 : val;
+	}
+
+	int srr = !report ? 0 : ast_true(report);
+
+	if (sms_batch_devs(resource, &devs, &ndevs)) {
+		return -1;
+	}
+
+	/* build all messages without device locks, dblock is held for whole batch */
+	smsdb_batch_begin();
+	for (i = 0; i < count; ++i) {
+		sms_batch_item_t *item = &items[i];
+		struct sms_batch_dev *dev = &devs[0];
+		at_sms_t *sms;
+
+		item->res = -1;
+		item->device[0] = '\0';
+		if (!is_valid_phone_number(item->number)) {
+			item->err = E_INVALID_PHONE_NUMBER;
+			continue;
+		}
+
+		for (d = 1; d < ndevs; ++d) {
+			if (devs[d].pending < dev->pending) {
+				dev = &devs[d];
+			}
+		}
+
+		sms = at_sms_prepare(dev->imsi, dev->group, item->number, item->message, val, srr, item->payload, item->payload_len);
+		if (!sms) {
+			item->err = chan_quectel_err;
+			continue;
+		}
+
+		AST_LIST_INSERT_TAIL(&dev->sms, sms, entry);
+		dev->pending++;
+		item->res = 0;
+		ast_copy_string(item->device, dev->id, sizeof(item->device));
+	}
+	smsdb_batch_end();
+
+	/* hand over to devices */
+	for (d = 0; d < ndevs; ++d) {
+		struct sms_batch_dev *dev = &devs[d];
+		struct pvt *pvt;
+
+		if (AST_LIST_EMPTY(&dev->sms)) {
+			continue;
+		}
+
+		pvt = find_device(dev->id);
+		if (pvt && pvt->connected && !strcmp(pvt->imsi, dev->imsi)) {
+			at_sms_t *sms;
+			AST_LIST_TRAVERSE(&dev->sms, sms, entry) {
+				pvt->sms_spool_count++;
+			}
+			AST_LIST_APPEND_LIST(&pvt->sms_spool, &dev->sms, entry);
+			pvt_sms_spool_run(pvt);
+			ast_mutex_unlock(&pvt->lock);
+			continue;
+		}
+		if (pvt) {
+			ast_mutex_unlock(&pvt->lock);
+		}
+
+		/* messages are kept in smsdb and resent when the device or other one of its group is ready */
+		ast_log(LOG_WARNING, "[%s] Device gone while preparing SMS batch, messages will be resent\n", dev->id);
+		sms_batch_unspool(dev);
+	}
+
+	for (i = 0; i < count; ++i) {
+		if (items[i].res == 0) {
+			queued++;
+		}
+	}
+
+	ast_free(devs);
+	return queued;
+}
+
 #/* */
 EXPORT_DEF int send_reset(const char *dev_name)
 {
@@ -8,11 +8,25 @@
 #include "dc_config.h"			/* call_waiting_t */
 #include "chan_quectel.h"		/* restate_time_t */
 
+/* one message of send_sms_batch() */
+typedef struct sms_batch_item
+{
+	const char	*number;
+	const char	*message;			/*!< utf-8 encoded message */
+	const char	*payload;
+	size_t		payload_len;
+
+	int		res;				/*!< result: 0 queued, -1 failed */
+	int		err;				/*!< error code if failed */
+	char		device[DEVNAMELEN];		/*!< device the message was queued on */
+} sms_batch_item_t;
+
 EXPORT_DECL int get_at_clir_value (struct pvt* pvt, int clir);
 
 /* return status string of sending, status arg is optional */
 EXPORT_DECL int send_ussd(const char *dev_name, const char *ussd);
-EXPORT_DECL int send_sms(const char *dev_name, const char *number, const char *message, const char *validity, const char *report, const char *payload, size_t payload_len);
+EXPORT_DECL int send_sms(const char *resource, const char *number, const char *message, const char *validity, const char *report, const char *payload, size_t payload_len, char *device);
+EXPORT_DECL int send_sms_batch(const char *resource, sms_batch_item_t *items, unsigned count, const char *validity, const char *report);
 EXPORT_DECL int send_reset(const char *dev_name);
 EXPORT_DECL int send_ccwa_set(const char *dev_name, call_waiting_t enable);
 EXPORT_DECL int send_at_command(const char *dev_name, const char *command);
@@ -0,0 +1,91 @@
+/*
+ *
+ * This program is free software, distributed under the terms of
+ * the GNU General Public License Version 2. See the LICENSE file
+ * at the top of the source tree.
+ */
+#include <stddef.h>			/* size_t */
+
+#include "histogram.h"
+
+/*!
+ * \brief Copy counters updated concurrently, each one is read atomically
+ * \param dst -- destination
+ * \param src -- counters
+ * \param count -- number of counters
+ */
+#/* */
+EXPORT_DEF void stat_copy(uint64_t * dst, const uint64_t * src, size_t count)
+{
+	size_t i;
+
+	for (i = 0; i < count; i++)
+	{
+		dst[i] = __atomic_load_n(&src[i], __ATOMIC_RELAXED);
+	}
+}
+
+#/* */
+EXPORT_DEF void hist_copy(struct histogram * dst, const struct histogram * src)
+{
+	stat_copy((uint64_t *) dst, (const uint64_t *) src, sizeof(*dst) / sizeof(uint64_t));
+}
+
+#/* add copy src to copy dst, not atomic */
+EXPORT_DEF void hist_merge(struct histogram * dst, const struct histogram * src)
+{
+	unsigned i;
+
+	dst->count += src->count;
+	dst->sum += src->sum;
+	if (src->max > dst->max)
+	{
+		dst->max = src->max;
+	}
+	for (i = 0; i < HIST_BUCKETS; i++)
+	{
+		dst->buckets[i] += src->buckets[i];
+	}
+}
+
+/*!
+ * \brief Estimate percentile
+ * \param hist -- histogram, usually copy by hist_copy()
+ * \param percent -- 0..100
+ * \return upper bound of bucket with percentile but not above max, 0 if empty
+ */
+#/* */
+EXPORT_DEF uint64_t hist_percentile(const struct histogram * hist, unsigned percent)
+{
+	uint64_t total = 0;
+	uint64_t rank;
+	uint64_t bound;
+	unsigned i;
+
+	for (i = 0; i < HIST_BUCKETS; i++)
+	{
+		total += hist->buckets[i];
+	}
+	if (total == 0)
+	{
+		return 0;
+	}
+
+	/* rank of value, 1 based */
+	rank = (total * percent + 99) / 100;
+	if (rank == 0)
+	{
+		rank = 1;
+	}
+	for (i = 0; i < HIST_BUCKETS - 1; i++)
+	{
+		if (rank <= hist->buckets[i])
+		{
+			break;
+		}
+		rank -= hist->buckets[i];
+	}
+
+	bound = i < HIST_BUCKETS - 1 ? (2ull << i) - 1 : hist->max;
+	return bound < hist->max ? bound : hist->max;
+}
@@ -0,0 +1,52 @@
+/*
+ *
+ * This program is free software, distributed under the terms of
+ * the GNU General Public License Version 2. See the LICENSE file
+ * at the top of the source tree.
+ */
+
+#ifndef CHAN_QUECTEL_HISTOGRAM_H_INCLUDED
+#define CHAN_QUECTEL_HISTOGRAM_H_INCLUDED
+
+#include <stdint.h>			/* uint64_t */
+
+#include "export.h"			/* EXPORT_DECL EXPORT_DEF */
+
+/* bucket 0 counts 0 and 1, bucket i > 0 values from 2^i to 2^(i+1)-1, last one all above */
+#define HIST_BUCKETS		24
+
+/* log2 bucketed histogram, all fields are uint64_t and updated atomically without locks */
+struct histogram {
+	uint64_t		count;				/*!< number of values */
+	uint64_t		sum;				/*!< sum of values */
+	uint64_t		max;				/*!< largest value */
+	uint64_t		buckets[HIST_BUCKETS];
+};
+
+/* index of bucket for value */
+INLINE_DECL unsigned hist_bucket(uint64_t value)
+{
+	unsigned bucket = value > 1 ? 63 - __builtin_clzll(value) : 0;
+
+	return bucket < HIST_BUCKETS ? bucket : HIST_BUCKETS - 1;
+}
+
+/* add value, may be called concurrently */
+INLINE_DECL void hist_add(struct histogram * hist, uint64_t value)
+{
+	uint64_t max = __atomic_load_n(&hist->max, __ATOMIC_RELAXED);
+
+	__atomic_fetch_add(&hist->buckets[hist_bucket(value)], 1, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&hist->sum, value, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&hist->count, 1, __ATOMIC_RELAXED);
+	while (value > max && !__atomic_compare_exchange_n(&hist->max, &max, value, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+	{
+	}
+}
+
+EXPORT_DECL void hist_copy(struct histogram * dst, const struct histogram * src);
+EXPORT_DECL void hist_merge(struct histogram * dst, const struct histogram * src);
+EXPORT_DECL uint64_t hist_percentile(const struct histogram * hist, unsigned percent);
+EXPORT_DECL void stat_copy(uint64_t * dst, const uint64_t * src, size_t count);
+
+#endif /* CHAN_QUECTEL_HISTOGRAM_H_INCLUDED */
@@ -17,6 +17,7 @@
 #include <asterisk/manager.h>			/* struct mansession, struct message ... */
 #include <asterisk/strings.h>			/* ast_strlen_zero() */
 #include <asterisk/callerid.h>			/* ast_describe_caller_presentation */
+#include <asterisk/lock.h>			/* ast_cond_t AST_MUTEX_DEFINE_STATIC() */
 
 #include "ast_compat.h"				/* asterisk compatibility fixes */
 
@@ -27,92 +28,155 @@
 
 static char * espace_newlines(const char * text);
 
+/* most devices in one QuectelDeviceBatch event */
+#define MANAGER_BATCH_MAX	64
+
+/* status and signal of device waiting for next QuectelDeviceBatch */
+struct manager_pending
+{
+	char			devname[DEVNAMELEN];
+	char			status[32];
+	int			rssi;
+	unsigned int		has_status:1;
+	unsigned int		has_rssi:1;
+};
+
+AST_MUTEX_DEFINE_STATIC(batch_lock);
+static ast_cond_t batch_cond;
+static pthread_t batch_thread = AST_PTHREADT_NULL;
+static int batch_stop;
+static struct manager_pending * batch_items;
+static size_t batch_count;
+static size_t batch_size;
+
+/* events sent by manager_event_message(), the other functions know their class */
+static const struct
+{
+	const char *	event;
+	unsigned	mask;
+	unsigned	sms_raw:1;		/*!< replaced by QuectelSMS with amismsevent=combined */
+} manager_event_classes[] =
+{
+	{ "QuectelNewCMT", AMI_EVENT_RAW, 1 },
+	{ "QuectelNewCMGR", AMI_EVENT_RAW, 1 },
+	{ "QuectelNewCUSD", AMI_EVENT_RAW, 0 },
+	{ "QuectelNewUSSDBase64", AMI_EVENT_USSD, 0 },
+	{ "QuectelPortFail", AMI_EVENT_PORT, 0 },
+};
+
+#/* check before formatting, 'amievents' setting */
+static int manager_event_enabled(unsigned mask)
+{
+	return (CONF_GLOBAL(ami_events) & mask) != 0;
+}
+
+#/* */
+static int manager_event_message_enabled(const char * event)
+{
+	unsigned i;
+
+	for (i = 0; i < ITEMS_OF(manager_event_classes); i++)
+	{
+		if (!strcmp(event, manager_event_classes[i].event))
+		{
+			return manager_event_enabled(manager_event_classes[i].mask)
+				&& !(manager_event_classes[i].sms_raw && CONF_GLOBAL(ami_sms_combined));
+		}
+	}
+	return 1;
+}
+
+#/* collect status and signal for QuectelDeviceBatch */
+static int manager_batch_enabled()
+{
+	return CONF_GLOBAL(ami_coalesce) > 0 && batch_thread != AST_PTHREADT_NULL;
+}
+
 static int manager_show_devices (struct mansession* s, const struct message* m)
 {
 	const char * id = astman_get_header (m, "ActionID");
 	const char * device = astman_get_header (m, "Device");
-	struct pvt * pvt;
-	size_t count = 0;
+	struct pvt_snapshot * snaps;
+	struct pvt_snapshot * snap;
+	size_t count;
+	size_t i;
 	char buf[40];
 
+	/* copy devices first, AMI client may be slow */
+	snaps = pvt_snapshot_list(device, &count);
+
 	astman_send_listack (s, m, "Device status list will follow", "start");
 
-	AST_RWLIST_RDLOCK (&gpublic->devices);
-	AST_RWLIST_TRAVERSE (&gpublic->devices, pvt, entry)
+	for (i = 0; i < count; i++)
 	{
-		ast_mutex_lock (&pvt->lock);
-		if(ast_strlen_zero(device) || strcmp(device, PVT_ID(pvt)) == 0)
-		{
-			astman_append (s, "Event: QuectelDeviceEntry\r\n");
-			if(!ast_strlen_zero (id))
-				astman_append (s, "ActionID: %s\r\n", id);
-			astman_append (s, "Device: %s\r\n", PVT_ID(pvt));
-/* settings */          if (strcmp(CONF_UNIQ(pvt, quec_uac),"1") == 0) astman_append (s, "AudioSetting: %s\r\n", CONF_UNIQ(pvt, alsadev));
-			else astman_append (s, "AudioSetting: %s\r\n", CONF_UNIQ(pvt, audio_tty));
-			astman_append (s, "DataSetting: %s\r\n", CONF_UNIQ(pvt, data_tty));
-			astman_append (s, "IMEISetting: %s\r\n", CONF_UNIQ(pvt, imei));
-			astman_append (s, "IMSISetting: %s\r\n", CONF_UNIQ(pvt, imsi));
-			astman_append (s, "ChannelLanguage: %s\r\n", CONF_SHARED(pvt, language));
-			astman_append (s, "Context: %s\r\n", CONF_SHARED(pvt, context));
-			astman_append (s, "Exten: %s\r\n", CONF_SHARED(pvt, exten));
-			astman_append (s, "Group: %d\r\n", CONF_SHARED(pvt, group));
-			astman_append (s, "RXGain: %d\r\n", CONF_SHARED(pvt, rxgain));
-			astman_append (s, "TXGain: %d\r\n", CONF_SHARED(pvt, txgain));
-			astman_append (s, "U2DIAG: %d\r\n", CONF_SHARED(pvt, u2diag));
-			astman_append (s, "UseCallingPres: %s\r\n", CONF_SHARED(pvt, usecallingpres) ? "Yes" : "No");
-			astman_append (s, "DefaultCallingPres: %s\r\n", CONF_SHARED(pvt, callingpres) < 0 ? "<Not set>" : ast_describe_caller_presentation (CONF_SHARED(pvt, callingpres)));
-			astman_append (s, "AutoDeleteSMS: %s\r\n", CONF_SHARED(pvt, autodeletesms) ? "Yes" : "No");
-			astman_append (s, "DisableSMS: %s\r\n", CONF_SHARED(pvt, disablesms) ? "Yes" : "No");
-			astman_append (s, "ResetQuectel: %s\r\n", CONF_SHARED(pvt, resetquectel) ? "Yes" : "No");
-			astman_append (s, "CallWaitingSetting: %s\r\n", dc_cw_setting2str(CONF_SHARED(pvt, callwaiting)));
-			astman_append (s, "DTMF: %s\r\n", dc_dtmf_setting2str(CONF_SHARED(pvt, dtmf)));
-			astman_append (s, "MinimalDTMFGap: %d\r\n", CONF_SHARED(pvt, mindtmfgap));
-			astman_append (s, "MinimalDTMFDuration: %d\r\n", CONF_SHARED(pvt, mindtmfduration));
-			astman_append (s, "MinimalDTMFInterval: %d\r\n", CONF_SHARED(pvt, mindtmfinterval));
+		snap = &snaps[i];
+		astman_append (s, "Event: QuectelDeviceEntry\r\n");
+		if(!ast_strlen_zero (id))
+			astman_append (s, "ActionID: %s\r\n", id);
+		astman_append (s, "Device: %s\r\n", UCONFIG(&snap->settings, id));
+/* settings */          if (strcmp(UCONFIG(&snap->settings, quec_uac),"1") == 0) astman_append (s, "AudioSetting: %s\r\n", UCONFIG(&snap->settings, alsadev));
+		else astman_append (s, "AudioSetting: %s\r\n", UCONFIG(&snap->settings, audio_tty));
+		astman_append (s, "DataSetting: %s\r\n", UCONFIG(&snap->settings, data_tty));
+		astman_append (s, "IMEISetting: %s\r\n", UCONFIG(&snap->settings, imei));
+		astman_append (s, "IMSISetting: %s\r\n", UCONFIG(&snap->settings, imsi));
+		astman_append (s, "ChannelLanguage: %s\r\n", SCONFIG(&snap->settings, language));
+		astman_append (s, "Context: %s\r\n", SCONFIG(&snap->settings, context));
+		astman_append (s, "Exten: %s\r\n", SCONFIG(&snap->settings, exten));
+		astman_append (s, "Group: %d\r\n", SCONFIG(&snap->settings, group));
+		astman_append (s, "RXGain: %d\r\n", SCONFIG(&snap->settings, rxgain));
+		astman_append (s, "TXGain: %d\r\n", SCONFIG(&snap->settings, txgain));
+		astman_append (s, "U2DIAG: %d\r\n", SCONFIG(&snap->settings, u2diag));
+		astman_append (s, "UseCallingPres: %s\r\n", SCONFIG(&snap->settings, usecallingpres) ? "Yes" : "No");
+		astman_append (s, "DefaultCallingPres: %s\r\n", SCONFIG(&snap->settings, callingpres) < 0 ? "<Not set>" : ast_describe_caller_presentation (SCONFIG(&snap->settings, callingpres)));
+		astman_append (s, "AutoDeleteSMS: %s\r\n", SCONFIG(&snap->settings, autodeletesms) ? "Yes" : "No");
+		astman_append (s, "DisableSMS: %s\r\n", SCONFIG(&snap->settings, disablesms) ? "Yes" : "No");
+		astman_append (s, "ResetQuectel: %s\r\n", SCONFIG(&snap->settings, resetquectel) ? "Yes" : "No");
+		astman_append (s, "CallWaitingSetting: %s\r\n", dc_cw_setting2str(SCONFIG(&snap->settings, callwaiting)));
+		astman_append (s, "DTMF: %s\r\n", dc_dtmf_setting2str(SCONFIG(&snap->settings, dtmf)));
+		astman_append (s, "MinimalDTMFGap: %d\r\n", SCONFIG(&snap->settings, mindtmfgap));
+		astman_append (s, "MinimalDTMFDuration: %d\r\n", SCONFIG(&snap->settings, mindtmfduration));
+		astman_append (s, "MinimalDTMFInterval: %d\r\n", SCONFIG(&snap->settings, mindtmfinterval));
 /* state */
-			astman_append (s, "State: %s\r\n", pvt_str_state(pvt));
-                        if (strcmp(CONF_UNIQ(pvt, quec_uac),"1") == 0) astman_append (s, "AudioState: %s\r\n", CONF_UNIQ(pvt, alsadev));
-			else astman_append (s, "AudioState: %s\r\n", PVT_STATE(pvt, audio_tty));
-			astman_append (s, "DataState: %s\r\n", PVT_STATE(pvt, data_tty));
-			astman_append (s, "Voice: %s\r\n", (pvt->has_voice) ? "Yes" : "No");
-			astman_append (s, "SMS: %s\r\n", (pvt->has_sms) ? "Yes" : "No");
-			astman_append (s, "Manufacturer: %s\r\n", pvt->manufacturer);
-			astman_append (s, "Model: %s\r\n", pvt->model);
-			astman_append (s, "Firmware: %s\r\n", pvt->firmware);
-			astman_append (s, "IMEIState: %s\r\n", pvt->imei);
-			astman_append (s, "IMSIState: %s\r\n", pvt->imsi);
-			astman_append (s, "GSMRegistrationStatus: %s\r\n", GSM_regstate2str(pvt->gsm_reg_status));
-			astman_append (s, "RSSI: %d, %s\r\n", pvt->rssi, rssi2dBm(pvt->rssi, buf, sizeof(buf)));
-			astman_append (s, "Mode: %s\r\n", sys_mode2str(pvt->linkmode));
-			astman_append (s, "Submode: %s\r\n", sys_submode2str(pvt->linksubmode));
-			astman_append (s, "ProviderName: %s\r\n", pvt->provider_name);
-			astman_append (s, "LocationAreaCode: %s\r\n", pvt->location_area_code);
-			astman_append (s, "CellID: %s\r\n", pvt->cell_id);
-			astman_append (s, "SubscriberNumber: %s\r\n", pvt->subscriber_number);
-			astman_append (s, "SMSServiceCenter: %s\r\n", pvt->sms_scenter);
-			astman_append (s, "UseUCS2Encoding: %s\r\n", pvt->use_ucs2_encoding ? "Yes" : "No");
-			astman_append (s, "TasksInQueue: %u\r\n", PVT_STATE(pvt, at_tasks));
-			astman_append (s, "CommandsInQueue: %u\r\n", PVT_STATE(pvt, at_cmds));
-			astman_append (s, "CallWaitingState: %s\r\n", pvt->has_call_waiting ? "Enabled" : "Disabled");
-			astman_append (s, "CurrentDeviceState: %s\r\n", dev_state2str(pvt->current_state));
-			astman_append (s, "DesiredDeviceState: %s\r\n", dev_state2str(pvt->desired_state));
-			astman_append (s, "CallsChannels: %u\r\n", PVT_STATE(pvt, chansno));
-			astman_append (s, "Active: %u\r\n", PVT_STATE(pvt, chan_count[CALL_STATE_ACTIVE]));
-			astman_append (s, "Held: %u\r\n", PVT_STATE(pvt, chan_count[CALL_STATE_ONHOLD]));
-			astman_append (s, "Dialing: %u\r\n", PVT_STATE(pvt, chan_count[CALL_STATE_DIALING]));
-			astman_append (s, "Alerting: %u\r\n", PVT_STATE(pvt, chan_count[CALL_STATE_ALERTING]));
-			astman_append (s, "Incoming: %u\r\n", PVT_STATE(pvt, chan_count[CALL_STATE_INCOMING]));
-			astman_append (s, "Waiting: %u\r\n", PVT_STATE(pvt, chan_count[CALL_STATE_WAITING]));
-			astman_append (s, "Releasing: %u\r\n", PVT_STATE(pvt, chan_count[CALL_STATE_RELEASED]));
-			astman_append (s, "Initializing: %u\r\n", PVT_STATE(pvt, chan_count[CALL_STATE_INIT]));
+		astman_append (s, "State: %s\r\n", snap->str_state);
+		if (strcmp(UCONFIG(&snap->settings, quec_uac),"1") == 0) astman_append (s, "AudioState: %s\r\n", UCONFIG(&snap->settings, alsadev));
+		else astman_append (s, "AudioState: %s\r\n", PVT_STATE_T(&snap->state, audio_tty));
+		astman_append (s, "DataState: %s\r\n", PVT_STATE_T(&snap->state, data_tty));
+		astman_append (s, "Voice: %s\r\n", (snap->has_voice) ? "Yes" : "No");
+		astman_append (s, "SMS: %s\r\n", (snap->has_sms) ? "Yes" : "No");
+		astman_append (s, "Manufacturer: %s\r\n", snap->manufacturer);
+		astman_append (s, "Model: %s\r\n", snap->model);
+		astman_append (s, "Firmware: %s\r\n", snap->firmware);
+		astman_append (s, "IMEIState: %s\r\n", snap->imei);
+		astman_append (s, "IMSIState: %s\r\n", snap->imsi);
+		astman_append (s, "GSMRegistrationStatus: %s\r\n", GSM_regstate2str(snap->gsm_reg_status));
+		astman_append (s, "RSSI: %d, %s\r\n", snap->rssi, rssi2dBm(snap->rssi, buf, sizeof(buf)));
+		astman_append (s, "Mode: %s\r\n", sys_mode2str(snap->linkmode));
+		astman_append (s, "Submode: %s\r\n", sys_submode2str(snap->linksubmode));
+		astman_append (s, "ProviderName: %s\r\n", snap->provider_name);
+		astman_append (s, "LocationAreaCode: %s\r\n", snap->location_area_code);
+		astman_append (s, "CellID: %s\r\n", snap->cell_id);
+		astman_append (s, "SubscriberNumber: %s\r\n", snap->subscriber_number);
+		astman_append (s, "SMSServiceCenter: %s\r\n", snap->sms_scenter);
+		astman_append (s, "UseUCS2Encoding: %s\r\n", snap->use_ucs2_encoding ? "Yes" : "No");
+		astman_append (s, "TasksInQueue: %u\r\n", PVT_STATE_T(&snap->state, at_tasks));
+		astman_append (s, "CommandsInQueue: %u\r\n", PVT_STATE_T(&snap->state, at_cmds));
+		astman_append (s, "CallWaitingState: %s\r\n", snap->has_call_waiting ? "Enabled" : "Disabled");
+		astman_append (s, "CurrentDeviceState: %s\r\n", dev_state2str(snap->current_state));
+		astman_append (s, "DesiredDeviceState: %s\r\n", dev_state2str(snap->desired_state));
+		astman_append (s, "CallsChannels: %u\r\n", PVT_STATE_T(&snap->state, chansno));
+		astman_append (s, "Active: %u\r\n", PVT_STATE_T(&snap->state, chan_count[CALL_STATE_ACTIVE]));
+		astman_append (s, "Held: %u\r\n", PVT_STATE_T(&snap->state, chan_count[CALL_STATE_ONHOLD]));
+		astman_append (s, "Dialing: %u\r\n", PVT_STATE_T(&snap->state, chan_count[CALL_STATE_DIALING]));
+		astman_append (s, "Alerting: %u\r\n", PVT_STATE_T(&snap->state, chan_count[CALL_STATE_ALERTING]));
+		astman_append (s, "Incoming: %u\r\n", PVT_STATE_T(&snap->state, chan_count[CALL_STATE_INCOMING]));
+		astman_append (s, "Waiting: %u\r\n", PVT_STATE_T(&snap->state, chan_count[CALL_STATE_WAITING]));
+		astman_append (s, "Releasing: %u\r\n", PVT_STATE_T(&snap->state, chan_count[CALL_STATE_RELEASED]));
+		astman_append (s, "Initializing: %u\r\n", PVT_STATE_T(&snap->state, chan_count[CALL_STATE_INIT]));
 /* TODO: stats */
 
-			astman_append (s, "\r\n");
-			count++;
-		}
-		ast_mutex_unlock (&pvt->lock);
+		astman_append (s, "\r\n");
 	}
-	AST_RWLIST_UNLOCK (&gpublic->devices);
+	ast_free(snaps);
 
 	astman_append (s, "Event: QuectelShowDevicesComplete\r\n");
 	if(!ast_strlen_zero (id))
@@ -127,6 +191,207 @@ static int manager_show_devices (struct mansession* s, const struct message* m)
 	return 0;
 }
 
+#/* */
+static void manager_append_hist (struct mansession* s, const char * name, const struct histogram * hist)
+{
+	astman_append (s, "%sCount: %llu\r\n", name, (unsigned long long int) hist->count);
+	astman_append (s, "%sP50: %llu\r\n", name, (unsigned long long int) hist_percentile (hist, 50));
+	astman_append (s, "%sP90: %llu\r\n", name, (unsigned long long int) hist_percentile (hist, 90));
+	astman_append (s, "%sP99: %llu\r\n", name, (unsigned long long int) hist_percentile (hist, 99));
+	astman_append (s, "%sMax: %llu\r\n", name, (unsigned long long int) hist->max);
+}
+
+#/* names of all devices, only names are copied as each device is looked up again by index */
+static char (*manager_device_names(size_t * count))[DEVNAMELEN]
+{
+	struct pvt * pvt;
+	char (*names)[DEVNAMELEN] = NULL;
+	size_t size = 0;
+
+	*count = 0;
+	AST_RWLIST_RDLOCK(&gpublic->devices);
+	AST_RWLIST_TRAVERSE(&gpublic->devices, pvt, entry)
+	{
+		size++;
+	}
+	if (size)
+	{
+		names = ast_malloc (size * sizeof (*names));
+	}
+	if (names)
+	{
+		/* id is not changed by reload, list lock keeps device alive */
+		AST_RWLIST_TRAVERSE(&gpublic->devices, pvt, entry)
+		{
+			ast_copy_string (names[(*count)++], PVT_ID(pvt), sizeof (*names));
+		}
+	}
+	AST_RWLIST_UNLOCK(&gpublic->devices);
+
+	return names;
+}
+
+static int manager_show_device_statistics (struct mansession* s, const struct message* m)
+{
+	const char * id = astman_get_header (m, "ActionID");
+	const char * device = astman_get_header (m, "Device");
+	char (*names)[DEVNAMELEN] = NULL;
+	struct pvt * pvt;
+	pvt_stat_t * stat;
+	struct histogram at_latency;
+	size_t count;
+	size_t listed = 0;
+	size_t i;
+	unsigned cmd;
+
+	stat = ast_malloc (sizeof (*stat));
+	if (!stat)
+	{
+		astman_send_error (s, m, "Out of memory");
+		return 0;
+	}
+	if (ast_strlen_zero (device))
+	{
+		names = manager_device_names (&count);
+	}
+	else
+	{
+		count = 1;
+	}
+
+	astman_send_listack (s, m, "Device statistics will follow", "start");
+
+	for (i = 0; i < count; i++)
+	{
+		pvt = find_device (names ? names[i] : device);
+		if (!pvt)
+			continue;
+		pvt_stat_get (pvt, stat);
+		ast_mutex_unlock (&pvt->lock);
+
+		memset (&at_latency, 0, sizeof (at_latency));
+		for (cmd = 0; cmd < AT_CMDS_NUMBER; cmd++)
+			hist_merge (&at_latency, &stat->at_latency[cmd]);
+
+		astman_append (s, "Event: QuectelDeviceStatisticsEntry\r\n");
+		if(!ast_strlen_zero (id))
+			astman_append (s, "ActionID: %s\r\n", id);
+		astman_append (s, "Device: %s\r\n", names ? names[i] : device);
+		astman_append (s, "ATTasks: %llu\r\n", (unsigned long long int) PVT_STAT_T(stat, at_tasks));
+		astman_append (s, "ATCommands: %llu\r\n", (unsigned long long int) PVT_STAT_T(stat, at_cmds));
+		astman_append (s, "ATResponses: %llu\r\n", (unsigned long long int) PVT_STAT_T(stat, at_responses));
+		astman_append (s, "DataReadBytes: %llu\r\n", (unsigned long long int) PVT_STAT_T(stat, d_read_bytes));
+		astman_append (s, "DataWriteBytes: %llu\r\n", (unsigned long long int) PVT_STAT_T(stat, d_write_bytes));
+		astman_append (s, "AudioReadBytes: %llu\r\n", (unsigned long long int) PVT_STAT_T(stat, a_read_bytes));
+		astman_append (s, "AudioWriteBytes: %llu\r\n", (unsigned long long int) PVT_STAT_T(stat, a_write_bytes));
+		astman_append (s, "ReadFrames: %llu\r\n", (unsigned long long int) PVT_STAT_T(stat, read_frames));
+		astman_append (s, "ReadShortFrames: %llu\r\n", (unsigned long long int) PVT_STAT_T(stat, read_sframes));
+		astman_append (s, "WriteFrames: %llu\r\n", (unsigned long long int) PVT_STAT_T(stat, write_frames));
+		astman_append (s, "WriteShortFrames: %llu\r\n", (unsigned long long int) PVT_STAT_T(stat, write_tframes));
+		astman_append (s, "WriteSilenceFrames: %llu\r\n", (unsigned long long int) PVT_STAT_T(stat, write_sframes));
+		astman_append (s, "WriteOverflowBytes: %llu\r\n", (unsigned long long int) PVT_STAT_T(stat, write_rb_overflow_bytes));
+		astman_append (s, "WriteOverflows: %llu\r\n", (unsigned long long int) PVT_STAT_T(stat, write_rb_overflow));
+		astman_append (s, "IncomingCalls: %llu\r\n", (unsigned long long int) PVT_STAT_T(stat, in_calls));
+		astman_append (s, "WaitingCalls: %llu\r\n", (unsigned long long int) PVT_STAT_T(stat, cw_calls));
+		astman_append (s, "HandledCalls: %llu\r\n", (unsigned long long int) PVT_STAT_T(stat, in_calls_handled));
+		astman_append (s, "PBXFails: %llu\r\n", (unsigned long long int) PVT_STAT_T(stat, in_pbx_fails));
+		astman_append (s, "OutgoingCalls: %llu\r\n", (unsigned long long int) PVT_STAT_T(stat, out_calls));
+		astman_append (s, "AnsweredOutgoing: %llu\r\n", (unsigned long long int) PVT_STAT_T(stat, calls_answered[CALL_DIR_OUTGOING]));
+		astman_append (s, "AnsweredIncoming: %llu\r\n", (unsigned long long int) PVT_STAT_T(stat, calls_answered[CALL_DIR_INCOMING]));
+		astman_append (s, "SecondsOutgoing: %llu\r\n", (unsigned long long int) PVT_STAT_T(stat, calls_duration[CALL_DIR_OUTGOING]));
+		astman_append (s, "SecondsIncoming: %llu\r\n", (unsigned long long int) PVT_STAT_T(stat, calls_duration[CALL_DIR_INCOMING]));
+		manager_append_hist (s, "ATLatency", &at_latency);
+		manager_append_hist (s, "ReadJitter", &stat->a_read_jitter);
+		manager_append_hist (s, "WriteJitter", &stat->a_write_jitter);
+		manager_append_hist (s, "LockHold", &stat->lock_hold);
+		astman_append (s, "\r\n");
+		listed++;
+	}
+	ast_free(names);
+	ast_free(stat);
+
+	astman_append (s, "Event: QuectelShowDeviceStatisticsComplete\r\n");
+	if(!ast_strlen_zero (id))
+		astman_append (s, "ActionID: %s\r\n", id);
+	astman_append (s,
+		"EventList: Complete\r\n"
+		"ListItems: %zu\r\n"
+		"\r\n",
+		listed
+	);
+
+	return 0;
+}
+
+static int manager_show_device_latency (struct mansession* s, const struct message* m)
+{
+	const char * id = astman_get_header (m, "ActionID");
+	const char * device = astman_get_header (m, "Device");
+	struct pvt * pvt;
+	pvt_stat_t * stat;
+	const struct histogram * hist;
+	size_t listed = 0;
+	unsigned cmd;
+
+	if (ast_strlen_zero (device))
+	{
+		astman_send_error (s, m, "Device not specified");
+		return 0;
+	}
+
+	stat = ast_malloc (sizeof (*stat));
+	if (!stat)
+	{
+		astman_send_error (s, m, "Out of memory");
+		return 0;
+	}
+
+	pvt = find_device (device);
+	if (!pvt)
+	{
+		ast_free (stat);
+		astman_send_error (s, m, "Device not found");
+		return 0;
+	}
+	pvt_stat_get (pvt, stat);
+	ast_mutex_unlock (&pvt->lock);
+
+	astman_send_listack (s, m, "Command latency list will follow", "start");
+
+	for (cmd = 0; cmd < AT_CMDS_NUMBER; cmd++)
+	{
+		hist = &stat->at_latency[cmd];
+		if (hist->count == 0 && stat->at_timeouts[cmd] == 0 && stat->at_errors[cmd] == 0 && stat->at_cms_errors[cmd] == 0)
+			continue;
+
+		astman_append (s, "Event: QuectelDeviceLatencyEntry\r\n");
+		if(!ast_strlen_zero (id))
+			astman_append (s, "ActionID: %s\r\n", id);
+		astman_append (s, "Device: %s\r\n", device);
+		astman_append (s, "Command: %s\r\n", at_cmd2str (cmd));
+		astman_append (s, "Average: %llu\r\n", (unsigned long long int) (hist->count ? hist->sum / hist->count : 0));
+		manager_append_hist (s, "", hist);
+		astman_append (s, "Timeouts: %llu\r\n", (unsigned long long int) stat->at_timeouts[cmd]);
+		astman_append (s, "Errors: %llu\r\n", (unsigned long long int) stat->at_errors[cmd]);
+		astman_append (s, "CMSErrors: %llu\r\n", (unsigned long long int) stat->at_cms_errors[cmd]);
+		astman_append (s, "\r\n");
+		listed++;
+	}
+	ast_free (stat);
+
+	astman_append (s, "Event: QuectelShowDeviceLatencyComplete\r\n");
+	if(!ast_strlen_zero (id))
+		astman_append (s, "ActionID: %s\r\n", id);
+	astman_append (s,
+		"EventList: Complete\r\n"
+		"ListItems: %zu\r\n"
+		"\r\n",
+		listed
+	);
+
+	return 0;
+}
+
 static int manager_send_ussd (struct mansession* s, const struct message* m)
 {
 	const char*	device	= astman_get_header (m, "Device");
@@ -163,6 +428,7 @@ static int manager_send_sms (struct mansession* s, const struct message* m)
 	const char*	payload	= astman_get_header (m, "Payload");
 
 	char		buf[256];
+	char		used[DEVNAMELEN];
 
 	if (ast_strlen_zero (device))
 	{
@@ -191,17 +457,185 @@ static int manager_send_sms (struct mansession* s, const struct message* m)
 	}
 
 	ast_unescape_c(unescaped_msg);
-	int res = send_sms(device, number, unescaped_msg, validity, report, payload, strlen(payload) + 1);
+	int res = send_sms(device, number, unescaped_msg, validity, report, payload, strlen(payload) + 1, used);
 	ast_free(unescaped_msg);
-	snprintf(buf, sizeof (buf), "[%s] %s", device, res < 0 ? error2str(chan_quectel_err) : "SMS queued for send");
+	snprintf(buf, sizeof (buf), "[%s] %s", res < 0 ? device : used, res < 0 ? error2str(chan_quectel_err) : "SMS queued for send");
 	(res == 0 ? astman_send_ack : astman_send_error)(s, m, buf);
 
 	return 0;
 }
 
+/* recipients sharing one message in QuectelSendSMSBatch */
+struct sms_batch_group
+{
+	char		*numbers;		/*!< comma separated list, modified by parser */
+	char		*message;		/*!< unescaped copy */
+	const char	*payload;
+};
+
+#/* */
+static int manager_send_sms_batch (struct mansession* s, const struct message* m)
+{
+	const char*	id	= astman_get_header (m, "ActionID");
+	const char*	device	= astman_get_header (m, "Device");
+	const char*	message	= astman_get_header (m, "Message"); /* may contain C-escapes */
+	const char*	validity= astman_get_header (m, "Validity");
+	const char*	report	= astman_get_header (m, "Report");
+	const char*	payload	= astman_get_header (m, "Payload");
+
+	struct sms_batch_group groups[AST_MAX_MANHEADERS];
+	sms_batch_item_t * items = NULL;
+	unsigned	ngroups = 0;
+	unsigned	count = 0;
+	unsigned	i, n;
+	char		hdr[32];
+	char		buf[256];
+	char *		number;
+	int		res;
+
+	if (ast_strlen_zero (device))
+	{
+		astman_send_error (s, m, "Device not specified");
+		return 0;
+	}
+
+	/* Number, Number1, Number2, ... each with optional own Message<N> and Payload<N> */
+	for (n = 0; n < ITEMS_OF(groups); n++)
+	{
+		const char * numbers;
+		const char * msg;
+		const char * pl;
+
+		if (n == 0)
+		{
+			numbers = astman_get_header (m, "Number");
+			if (ast_strlen_zero (numbers))
+				continue;
+			msg = message;
+			pl = payload;
+		}
+		else
+		{
+			snprintf (hdr, sizeof (hdr), "Number%u", n);
+			numbers = astman_get_header (m, hdr);
+			if (ast_strlen_zero (numbers))
+				break;
+			snprintf (hdr, sizeof (hdr), "Message%u", n);
+			msg = S_OR(astman_get_header (m, hdr), message);
+			snprintf (hdr, sizeof (hdr), "Payload%u", n);
+			pl = S_OR(astman_get_header (m, hdr), payload);
+		}
+
+		if (ast_strlen_zero (msg))
+		{
+			if (n)
+				snprintf (buf, sizeof (buf), "Message not specified for Number%u", n);
+			else
+				ast_copy_string (buf, "Message not specified", sizeof (buf));
+			astman_send_error (s, m, buf);
+			goto e_free;
+		}
+
+		groups[ngroups].numbers = ast_strdup (numbers);
+		groups[ngroups].message = ast_strdup (msg);
+		groups[ngroups].payload = pl;
+		ngroups++;
+		if (!groups[ngroups - 1].numbers || !groups[ngroups - 1].message)
+		{
+			astman_send_error (s, m, "Internal memory error");
+			goto e_free;
+		}
+		ast_unescape_c (groups[ngroups - 1].message);
+
+		for (; *numbers; numbers++)
+			if (*numbers == ',')
+				count++;
+		count++;
+	}
+
+	if (count == 0)
+	{
+		astman_send_error (s, m, "Number not specified");
+		goto e_free;
+	}
+
+	items = ast_calloc (count, sizeof (*items));
+	if (!items)
+	{
+		astman_send_error (s, m, "Internal memory error");
+		goto e_free;
+	}
+
+	count = 0;
+	for (n = 0; n < ngroups; n++)
+	{
+		char * list = groups[n].numbers;
+		while ((number = strsep (&list, ",")))
+		{
+			items[count].number = ast_strip (number);
+			items[count].message = groups[n].message;
+			items[count].payload = groups[n].payload;
+			items[count].payload_len = strlen (groups[n].payload) + 1;
+			count++;
+		}
+	}
+
+	res = send_sms_batch (device, items, count, validity, report);
+	if (res < 0)
+	{
+		snprintf (buf, sizeof (buf), "[%s] %s", device, error2str (chan_quectel_err));
+		astman_send_error (s, m, buf);
+		goto e_free;
+	}
+
+	astman_send_listack (s, m, "SMS batch status list will follow", "start");
+	for (i = 0; i < count; i++)
+	{
+		astman_append (s, "Event: QuectelSMSBatchEntry\r\n");
+		if (!ast_strlen_zero (id))
+			astman_append (s, "ActionID: %s\r\n", id);
+		astman_append (s,
+			"Index: %u\r\n"
+			"Number: %s\r\n"
+			"Device: %s\r\n"
+			"Status: %s\r\n"
+			"\r\n",
+			i,
+			items[i].number,
+			items[i].device,
+			items[i].res == 0 ? "Queued" : error2str (items[i].err)
+		);
+	}
+
+	astman_append (s, "Event: QuectelSendSMSBatchComplete\r\n");
+	if (!ast_strlen_zero (id))
+		astman_append (s, "ActionID: %s\r\n", id);
+	astman_append (s,
+		"EventList: Complete\r\n"
+		"ListItems: %u\r\n"
+		"Queued: %d\r\n"
+		"\r\n",
+		count,
+		res
+	);
+
+e_free:
+	ast_free (items);
+	for (n = 0; n < ngroups; n++)
+	{
+		ast_free (groups[n].numbers);
+		ast_free (groups[n].message);
+	}
+
+	return 0;
+}
+
 #/* */
 EXPORT_DEF void manager_event_report(const char * devname, const char *payload, size_t payload_len, const char *scts, const char *dt, int success, int type, const char *report_str)
 {
+	if (!manager_event_enabled(AMI_EVENT_REPORT))
+		return;
+
 	manager_event (EVENT_FLAG_CALL, "QuectelReport",
 		"Device: %s\r\n"
 		"Payload: %.*s\r\n"
@@ -234,6 +668,9 @@ EXPORT_DEF void manager_event_new_ussd (const char * devname, char* message)
 	char*		sl;
 	size_t		linecount = 0;
 
+	if (!manager_event_enabled(AMI_EVENT_USSD))
+		return;
+
 	buf = ast_str_create (256);
 
 	while ((sl = strsep (&s, "\r\n")))
@@ -261,7 +698,13 @@ EXPORT_DEF void manager_event_new_ussd (const char * devname, char* message)
 #/* */
 EXPORT_DEF void manager_event_message(const char * event, const char * devname, const char * message)
 {
-	char * escaped = espace_newlines(message);
+	char * escaped;
+
+	/* do not escape text of filtered events */
+	if (!manager_event_message_enabled(event))
+		return;
+
+	escaped = espace_newlines(message);
 	if(escaped) {
 		manager_event_message_raw(event, devname, escaped);
 		ast_free(escaped);
@@ -271,6 +714,9 @@ EXPORT_DEF void manager_event_message(const char * event, const char * devname,
 #/* */
 EXPORT_DEF void manager_event_message_raw(const char * event, const char * devname, const char * message)
 {
+	if (!manager_event_message_enabled(event))
+		return;
+
 	manager_event (EVENT_FLAG_CALL, event,
 		"Device: %s\r\n"
 		"Message: %s\r\n",
@@ -311,6 +757,9 @@ static char * espace_newlines(const char * text)
 #/* */
 EXPORT_DEF void manager_event_cend(const char * devname, int call_index, int duration, int end_status, int cc_cause)
 {
+	if (!manager_event_enabled(AMI_EVENT_CALL))
+		return;
+
 	manager_event( EVENT_FLAG_CALL, "QuectelCEND",
 		"Device: %s\r\n"
 		"CallIdx: %d\r\n"
@@ -328,6 +777,9 @@ EXPORT_DEF void manager_event_cend(const char * devname, int call_index, int dur
 #/* */
 EXPORT_DEF void manager_event_call_state_change(const char * devname, int call_index, const char * newstate)
 {
+	if (!manager_event_enabled(AMI_EVENT_CALL))
+		return;
+
 	manager_event(EVENT_FLAG_CALL, "QuectelCallStateChange",
 		"Device: %s\r\n"
 		"CallIdx: %d\r\n"
@@ -338,9 +790,128 @@ EXPORT_DEF void manager_event_call_state_change(const char * devname, int call_i
 		);
 }
 
+/*!
+ * \brief Find or add pending item of device
+ * \note batch_lock must be held
+ */
+#/* */
+static struct manager_pending * manager_batch_item(const char * devname)
+{
+	struct manager_pending * tmp;
+	size_t i;
+
+	for (i = 0; i < batch_count; i++)
+	{
+		if (!strcmp(batch_items[i].devname, devname))
+			return &batch_items[i];
+	}
+
+	if (batch_count == batch_size)
+	{
+		tmp = ast_realloc(batch_items, (batch_size + 16) * sizeof(*batch_items));
+		if (!tmp)
+			return NULL;
+		batch_items = tmp;
+		batch_size += 16;
+	}
+	tmp = &batch_items[batch_count++];
+	memset(tmp, 0, sizeof(*tmp));
+	ast_copy_string(tmp->devname, devname, sizeof(tmp->devname));
+	return tmp;
+}
+
+#/* */
+static void manager_batch_send(const struct manager_pending * items, size_t count)
+{
+	struct ast_str * buf;
+	size_t first;
+	size_t n;
+	size_t i;
+
+	if (!count)
+		return;
+
+	buf = ast_str_create (1024);
+	if (!buf)
+		return;
+
+	for (first = 0; first < count; first += n)
+	{
+		n = count - first < MANAGER_BATCH_MAX ? count - first : MANAGER_BATCH_MAX;
+		ast_str_reset (buf);
+		for (i = 0; i < n; i++)
+		{
+			ast_str_append (&buf, 0, "Device%zu: %s\r\n", i, items[first + i].devname);
+			if (items[first + i].has_status)
+				ast_str_append (&buf, 0, "Status%zu: %s\r\n", i, items[first + i].status);
+			if (items[first + i].has_rssi)
+				ast_str_append (&buf, 0, "RSSI%zu: %d\r\n", i, items[first + i].rssi);
+		}
+		manager_event (EVENT_FLAG_CALL, "QuectelDeviceBatch",
+			"Count: %zu\r\n"
+			"%s",
+			n, ast_str_buffer (buf)
+		);
+	}
+	ast_free (buf);
+}
+
+#/* send changes collected during 'amicoalesce' seconds */
+static void * manager_batch_thread(void * arg)
+{
+	struct manager_pending * items;
+	struct timeval tv;
+	struct timespec ts;
+	size_t count;
+	int interval;
+
+	ast_mutex_lock (&batch_lock);
+	while (!batch_stop)
+	{
+		/* interval may change by reload, idle devices are polled each second */
+		interval = CONF_GLOBAL(ami_coalesce);
+		tv = ast_tvadd (ast_tvnow (), ast_tv (interval > 0 ? interval : 1, 0));
+		ts.tv_sec = tv.tv_sec;
+		ts.tv_nsec = tv.tv_usec * 1000;
+		ast_cond_timedwait (&batch_cond, &batch_lock, &ts);
+
+		items = batch_items;
+		count = batch_count;
+		batch_items = NULL;
+		batch_count = batch_size = 0;
+
+		/* manager_event() may block on slow sessions, do not hold producers */
+		ast_mutex_unlock (&batch_lock);
+		manager_batch_send (items, count);
+		ast_free (items);
+		ast_mutex_lock (&batch_lock);
+	}
+	ast_mutex_unlock (&batch_lock);
+
+	return NULL;
+}
+
 #/* */
 EXPORT_DEF void manager_event_device_status(const char * devname, const char * newstate)
 {
+	struct manager_pending * item;
+
+	if (!manager_event_enabled(AMI_EVENT_STATUS))
+		return;
+
+	if (manager_batch_enabled())
+	{
+		ast_mutex_lock (&batch_lock);
+		item = manager_batch_item (devname);
+		if (item)
+		{
+			ast_copy_string (item->status, newstate, sizeof (item->status));
+			item->has_status = 1;
+		}
+		ast_mutex_unlock (&batch_lock);
+		return;
+	}
+
 	manager_event(EVENT_FLAG_CALL, "QuectelStatus",
 		"Device: %s\r\n"
 		"Status: %s\r\n",
@@ -349,6 +920,70 @@ EXPORT_DEF void manager_event_device_status(const char * devname, const char * n
 		);
 }
 
+/*!
+ * \brief Remember RSSI for next QuectelDeviceBatch
+ * \note signal is sent only with 'amicoalesce', changes are too frequent for own events
+ */
+#/* */
+EXPORT_DEF void manager_event_signal(const char * devname, int rssi)
+{
+	struct manager_pending * item;
+
+	if (!manager_event_enabled(AMI_EVENT_SIGNAL) || !manager_batch_enabled())
+		return;
+
+	ast_mutex_lock (&batch_lock);
+	item = manager_batch_item (devname);
+	if (item)
+	{
+		item->rssi = rssi;
+		item->has_rssi = 1;
+	}
+	ast_mutex_unlock (&batch_lock);
+}
+
+/*!
+ * \brief Send received SMS as QuectelNewSMS and QuectelNewSMSBase64 events or one QuectelSMS event
+ * \param devname -- device name
+ * \param number -- sender
+ * \param message -- text, not changed
+ * \param message_base64 -- base64 encoded text
+ */
+#/* */
+EXPORT_DEF void manager_event_sms(const char * devname, const char * number, const char * message, const char * message_base64)
+{
+	char * copy;
+
+	if (!manager_event_enabled(AMI_EVENT_SMS))
+		return;
+
+	if (CONF_GLOBAL(ami_sms_combined))
+	{
+		copy = espace_newlines(message);
+		if (copy)
+		{
+			manager_event (EVENT_FLAG_CALL, "QuectelSMS",
+				"Device: %s\r\n"
+				"From: %s\r\n"
+				"Message: %s\r\n"
+				"MessageBase64: %s\r\n",
+				devname, number, copy, message_base64
+			);
+			ast_free (copy);
+		}
+		return;
+	}
+
+	/* manager_event_new_sms() splits text in place */
+	copy = ast_strdup(message);
+	if (copy)
+	{
+		manager_event_new_sms (devname, (char *) number, copy);
+		ast_free (copy);
+	}
+	manager_event_new_sms_base64 (devname, (char *) number, (char *) message_base64);
+}
+
 
 /*!
  * \brief Send a QuectelNewSMS event to the manager
@@ -572,6 +1207,29 @@ static const struct quectel_manager
 	"	Device:   <name>	Optional name of device.\n"
 	},
 	{
+	manager_show_device_statistics,
+	EVENT_FLAG_SYSTEM | EVENT_FLAG_REPORTING,
+	"QuectelShowDeviceStatistics",
+	"Show statistics of Quectel devices",
+	"Description: Shows counters and latency percentiles of Quectel devices.\n\n"
+	"QuectelDeviceStatisticsEntry events followed by QuectelShowDeviceStatisticsComplete.\n"
+	"Histogram fields are in microseconds.\n"
+	"Variables:\n"
+	"	ActionID: <id>		Action ID for this transaction. Will be returned.\n"
+	"	Device:   <name>	Optional name of device.\n"
+	},
+	{
+	manager_show_device_latency,
+	EVENT_FLAG_SYSTEM | EVENT_FLAG_REPORTING,
+	"QuectelShowDeviceLatency",
+	"Show AT command latency of a Quectel device",
+	"Description: Shows round trip percentiles in microseconds and timeout, ERROR and +CMS ERROR counts of each AT command.\n\n"
+	"QuectelDeviceLatencyEntry events followed by QuectelShowDeviceLatencyComplete.\n"
+	"Variables: (Names marked with * are required)\n"
+	"	ActionID: <id>		Action ID for this transaction. Will be returned.\n"
+	"	*Device:  <name>	Name of device.\n"
+	},
+	{
 	manager_send_ussd,
 	EVENT_FLAG_CALL,
 	"QuectelSendUSSD",
@@ -590,7 +1248,8 @@ static const struct quectel_manager
 	"Description: Send a SMS message from a quectel.\n\n"
 	"Variables: (Names marked with * are required)\n"
 	"	ActionID: <id>		Action ID for this transaction. Will be returned.\n"
-	"	*Device:  <device>	The quectel to which the SMS be send.\n"
+	"	*Device:  <device>	The quectel to which the SMS be send, or g<N>, r<N>, p:<provider>, s:<imsi prefix>, i:<imei>\n"
+	"				to use the ready quectel with the shortest queue; name of used quectel is returned in the Message.\n"
 	"	*Number:  <number>	The phone number to which the SMS will be sent.\n"
 	"	*Message: <message>	The SMS message that will be sent (standard backslash escape sequences are used, e.g. '\\n' for newline).\n"
 	"	*Validity: <message>	Validity period in minutes.\n"
@@ -598,6 +1257,25 @@ static const struct quectel_manager
 	"	*Payload: <message>	Unstructured data that will be included in delivery report.\n"
 	},
 	{
+	manager_send_sms_batch,
+	EVENT_FLAG_CALL,
+	"QuectelSendSMSBatch",
+	"Send many SMS messages.",
+	"Description: Send SMS messages to many recipients from a quectel or a group of quectels.\n\n"
+	"QuectelSMSBatchEntry events with result of each message followed by QuectelSendSMSBatchComplete.\n"
+	"Variables: (Names marked with * are required)\n"
+	"	ActionID: <id>		Action ID for this transaction. Will be returned.\n"
+	"	*Device:  <device>	The quectel or g<N>, r<N>, p:<provider>, s:<imsi prefix>, i:<imei>, messages are spread over selected quectels.\n"
+	"	*Number:  <numbers>	Comma separated phone numbers to which the Message will be sent.\n"
+	"	*Message: <message>	The SMS message that will be sent (standard backslash escape sequences are used, e.g. '\\n' for newline).\n"
+	"	NumberN:  <numbers>	N = 1, 2, ... Comma separated phone numbers to which the MessageN will be sent.\n"
+	"	MessageN: <message>	Message for NumberN, default is Message.\n"
+	"	Validity: <message>	Validity period in minutes.\n"
+	"	Report: <message>	Boolean flag for report request.\n"
+	"	Payload: <message>	Unstructured data that will be included in delivery report, PayloadN overrides it for NumberN.\n"
+	"Messages are sent with rate limited by 'smsrate' setting of device.\n"
+	},
+	{
 	manager_ccwa_set,
 	EVENT_FLAG_CONFIG,
 	"QuectelSetCCWA",
@@ -673,6 +1351,22 @@ static const struct quectel_manager
 	},
 };
 
+/*!
+ * \brief Start batch thread when 'amicoalesce' is set and thread is not running yet
+ * \note thread keeps running when 'amicoalesce' is turned off by reload, events are sent at once then
+ */
+EXPORT_DEF void manager_batch_reload()
+{
+	if (CONF_GLOBAL(ami_coalesce) <= 0 || batch_thread != AST_PTHREADT_NULL)
+		return;
+
+	if (ast_pthread_create_background (&batch_thread, NULL, manager_batch_thread, NULL) < 0)
+	{
+		ast_log (LOG_ERROR, "Unable to start AMI event batch thread, status is sent at once\n");
+		batch_thread = AST_PTHREADT_NULL;
+	}
+}
+
 EXPORT_DEF void manager_register()
 {
 	unsigned i;
@@ -680,6 +1374,10 @@ EXPORT_DEF void manager_register()
 	struct ast_module* module = self_module();
 #endif /* ^13+ */
 
+	batch_stop = 0;
+	ast_cond_init (&batch_cond, NULL);
+	manager_batch_reload();
+
 	for(i = 0; i < ITEMS_OF(dcm); i++)
 	{
 #if ASTERISK_VERSION_NUM >= 130000 /* 13+ */
@@ -700,6 +1398,20 @@ EXPORT_DEF void manager_unregister()
 	{
 		ast_manager_unregister((char*)dcm[i].name);
 	}
+
+	if (batch_thread != AST_PTHREADT_NULL)
+	{
+		ast_mutex_lock (&batch_lock);
+		batch_stop = 1;
+		ast_cond_signal (&batch_cond);
+		ast_mutex_unlock (&batch_lock);
+		pthread_join (batch_thread, NULL);
+		batch_thread = AST_PTHREADT_NULL;
+	}
+	ast_cond_destroy (&batch_cond);
+	ast_free (batch_items);
+	batch_items = NULL;
+	batch_count = batch_size = 0;
 }
 
 #endif /* BUILD_MANAGER */
@@ -10,6 +10,7 @@
 
 EXPORT_DECL void manager_register();
 EXPORT_DECL void manager_unregister();
+EXPORT_DECL void manager_batch_reload();
 
 EXPORT_DECL void manager_event_message(const char * event, const char * devname, const char * message);
 EXPORT_DECL void manager_event_message_raw(const char * event, const char * devname, const char * message);
@@ -20,12 +21,15 @@ EXPORT_DECL void manager_event_new_sms_base64 (const char * devname, char * numb
 EXPORT_DECL void manager_event_cend(const char * devname, int call_index, int duration, int end_status, int cc_cause);
 EXPORT_DECL void manager_event_call_state_change(const char * devname, int call_index, const char * newstate);
 EXPORT_DECL void manager_event_device_status(const char * devname, const char * newstatus);
+EXPORT_DECL void manager_event_signal(const char * devname, int rssi);
+EXPORT_DECL void manager_event_sms(const char * devname, const char * number, const char * message, const char * message_base64);
 EXPORT_DECL void manager_event_report(const char * devname, const char *payload, size_t payload_len, const char *scts, const char *dt, int success, int type, const char *report_str);
 
 #else  /* BUILD_MANAGER */
 
 #define manager_register()
 #define manager_unregister()
+#define manager_batch_reload()
 
 #define manager_event_message(event, devname, message)
 #define manager_event_message_raw(event, devname, message)
@@ -35,6 +39,8 @@ EXPORT_DECL void manager_event_report(const char * devname, const char *payload,
 #define manager_event_cend(devname, call_index, duration, end_status, cc_cause)
 #define manager_event_call_state_change(devname, call_index, newstate)
 #define manager_event_device_status(devname, newstatus)
+#define manager_event_signal(devname, rssi)
+#define manager_event_sms(devname, number, message, message_base64)
 #define manager_event_report(devname, payload, payload_len, scts, dt, success, type, report_str)
 
 #endif /* BUILD_MANAGER */
@@ -0,0 +1,406 @@
+/*
+ *
+ * This program is free software, distributed under the terms of
+ * the GNU General Public License Version 2. See the LICENSE file
+ * at the top of the source tree.
+ */
+#include "ast_config.h"
+
+#include <stddef.h>				/* offsetof() */
+
+#include <asterisk/http.h>			/* ast_http_uri_link() ast_http_send() */
+#include <asterisk/strings.h>			/* ast_str_create() ast_str_append() */
+#include <asterisk/utils.h>			/* ast_malloc() ast_free() */
+
+#include "ast_compat.h"				/* asterisk compatibility fixes */
+
+#include "metrics.h"
+#include "chan_quectel.h"			/* gpublic pvt_status_get() pvt_state_get() */
+#include "helpers.h"				/* ITEMS_OF() */
+#include "histogram.h"				/* hist_copy() hist_merge() hist_percentile() */
+#include "smsdb.h"				/* smsdb_outgoing_backlog() */
+
+/* device copied for one scrape, pvt stays valid while devices list is read locked */
+struct metrics_device
+{
+	const struct pvt *	pvt;
+	char			id[DEVNAMELEN];
+	struct pvt_status	status;
+	pvt_state_t		state;
+	int			sms_backlog;
+};
+
+/* pvt_stat_t counter exported as is */
+static const struct metrics_counter
+{
+	const char *	name;
+	const char *	help;
+	const char *	labels;			/*!< extra labels or NULL */
+	size_t		offset;			/*!< of uint64_t in pvt_stat_t */
+} metrics_counters[] =
+{
+	{ "quectel_at_tasks_total", "Tasks added to AT queue", NULL, offsetof(pvt_stat_t, at_tasks) },
+	{ "quectel_at_commands_total", "Commands added to AT queue", NULL, offsetof(pvt_stat_t, at_cmds) },
+	{ "quectel_at_responses_total", "AT responses handled", NULL, offsetof(pvt_stat_t, at_responses) },
+	{ "quectel_data_read_bytes_total", "Bytes read from AT port", NULL, offsetof(pvt_stat_t, d_read_bytes) },
+	{ "quectel_data_write_bytes_total", "Bytes written to AT port", NULL, offsetof(pvt_stat_t, d_write_bytes) },
+	{ "quectel_audio_read_bytes_total", "Bytes of audio read", NULL, offsetof(pvt_stat_t, a_read_bytes) },
+	{ "quectel_audio_write_bytes_total", "Bytes of audio written", NULL, offsetof(pvt_stat_t, a_write_bytes) },
+	{ "quectel_read_frames_total", "Audio frames read", NULL, offsetof(pvt_stat_t, read_frames) },
+	{ "quectel_read_short_frames_total", "Truncated audio frames read", NULL, offsetof(pvt_stat_t, read_sframes) },
+	{ "quectel_write_frames_total", "Audio frames written", NULL, offsetof(pvt_stat_t, write_frames) },
+	{ "quectel_write_short_frames_total", "Truncated audio frames written", NULL, offsetof(pvt_stat_t, write_tframes) },
+	{ "quectel_write_silence_frames_total", "Silence frames written", NULL, offsetof(pvt_stat_t, write_sframes) },
+	{ "quectel_write_overflow_bytes_total", "Bytes lost by audio write buffer overflow", NULL, offsetof(pvt_stat_t, write_rb_overflow_bytes) },
+	{ "quectel_write_overflows_total", "Audio write buffer overflows", NULL, offsetof(pvt_stat_t, write_rb_overflow) },
+	{ "quectel_incoming_calls_total", "Incoming calls not including waiting", NULL, offsetof(pvt_stat_t, in_calls) },
+	{ "quectel_waiting_calls_total", "Waiting calls", NULL, offsetof(pvt_stat_t, cw_calls) },
+	{ "quectel_handled_calls_total", "Incoming and waiting calls passed to dialplan", NULL, offsetof(pvt_stat_t, in_calls_handled) },
+	{ "quectel_pbx_fails_total", "Failures to start PBX for incoming calls", NULL, offsetof(pvt_stat_t, in_pbx_fails) },
+	{ "quectel_outgoing_calls_total", "Outgoing call attempts", NULL, offsetof(pvt_stat_t, out_calls) },
+	{ "quectel_answered_calls_total", "Answered calls", "direction=\"outgoing\"", offsetof(pvt_stat_t, calls_answered[CALL_DIR_OUTGOING]) },
+	{ "quectel_answered_calls_total", NULL, "direction=\"incoming\"", offsetof(pvt_stat_t, calls_answered[CALL_DIR_INCOMING]) },
+	{ "quectel_call_seconds_total", "Seconds of answered calls", "direction=\"outgoing\"", offsetof(pvt_stat_t, calls_duration[CALL_DIR_OUTGOING]) },
+	{ "quectel_call_seconds_total", NULL, "direction=\"incoming\"", offsetof(pvt_stat_t, calls_duration[CALL_DIR_INCOMING]) },
+};
+
+/* per AT command counters, only commands with non zero value are exported */
+static const struct metrics_counter metrics_cmd_counters[] =
+{
+	{ "quectel_at_timeouts_total", "AT commands without response in time", NULL, offsetof(pvt_stat_t, at_timeouts) },
+	{ "quectel_at_errors_total", "AT commands answered by ERROR", NULL, offsetof(pvt_stat_t, at_errors) },
+	{ "quectel_at_cms_errors_total", "AT commands answered by +CMS ERROR", NULL, offsetof(pvt_stat_t, at_cms_errors) },
+};
+
+/* histograms exported as summaries, at_latency is merged over commands */
+static const struct metrics_counter metrics_summaries[] =
+{
+	{ "quectel_at_latency_microseconds", "Round trip of AT commands", NULL, offsetof(pvt_stat_t, at_latency) },
+	{ "quectel_audio_read_jitter_microseconds", "Deviation of audio frame read interval", NULL, offsetof(pvt_stat_t, a_read_jitter) },
+	{ "quectel_audio_write_jitter_microseconds", "Deviation of audio frame write interval", NULL, offsetof(pvt_stat_t, a_write_jitter) },
+	{ "quectel_lock_hold_microseconds", "Device lock held by monitor thread", NULL, offsetof(pvt_stat_t, lock_hold) },
+};
+
+#/* */
+static uint64_t metrics_load(const struct pvt * pvt, size_t offset)
+{
+	uint64_t value;
+
+	stat_copy(&value, (const uint64_t *) ((const char *) &pvt->stat + offset), 1);
+	return value;
+}
+
+#/* append label value escaped as exposition format requires */
+static void metrics_escape(struct ast_str ** out, const char * value)
+{
+	for (; *value; value++)
+	{
+		switch (*value)
+		{
+			case '\\':
+				ast_str_append(out, 0, "\\\\");
+				break;
+			case '"':
+				ast_str_append(out, 0, "\\\"");
+				break;
+			case '\n':
+				ast_str_append(out, 0, "\\n");
+				break;
+			default:
+				ast_str_append(out, 0, "%c", *value);
+				break;
+		}
+	}
+}
+
+#/* */
+static void metrics_family(struct ast_str ** out, const char * name, const char * help, const char * type)
+{
+	ast_str_append(out, 0, "# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+}
+
+#/* metric name with device label and optional extra labels, value follows */
+static void metrics_sample(struct ast_str ** out, const char * name, const struct metrics_device * dev, const char * labels)
+{
+	ast_str_append(out, 0, "%s{device=\"", name);
+	metrics_escape(out, dev->id);
+	ast_str_append(out, 0, "\"%s%s} ", labels ? "," : "", labels ? labels : "");
+}
+
+#/* */
+static void metrics_summary(struct ast_str ** out, const char * name, const struct metrics_device * dev, const struct histogram * hist)
+{
+	static const unsigned quantiles[] = { 50, 90, 99 };
+	char labels[32];
+	unsigned i;
+
+	for (i = 0; i < ITEMS_OF(quantiles); i++)
+	{
+		snprintf(labels, sizeof(labels), "quantile=\"0.%02u\"", quantiles[i]);
+		metrics_sample(out, name, dev, labels);
+		ast_str_append(out, 0, "%llu\n", (unsigned long long int) hist_percentile(hist, quantiles[i]));
+	}
+	ast_str_append(out, 0, "%s_sum{device=\"", name);
+	metrics_escape(out, dev->id);
+	ast_str_append(out, 0, "\"} %llu\n", (unsigned long long int) hist->sum);
+	ast_str_append(out, 0, "%s_count{device=\"", name);
+	metrics_escape(out, dev->id);
+	ast_str_append(out, 0, "\"} %llu\n", (unsigned long long int) hist->count);
+}
+
+/*!
+ * \brief Copy devices for one scrape
+ * \param backlog -- result of smsdb_outgoing_backlog()
+ * \param backlogs -- number of items in backlog
+ * \param count -- number of copied devices
+ * \note devices list must be read locked, pvt locks are not taken
+ */
+#/* */
+static struct metrics_device * metrics_devices(const struct smsdb_backlog * backlog, int backlogs, size_t * count)
+{
+	struct metrics_device * devs = NULL;
+	struct metrics_device * tmp;
+	struct pvt * pvt;
+	size_t size = 0;
+	int i;
+
+	*count = 0;
+	AST_RWLIST_TRAVERSE(&gpublic->devices, pvt, entry)
+	{
+		if (*count == size)
+		{
+			tmp = ast_realloc(devs, (size + 16) * sizeof(*devs));
+			if (!tmp)
+			{
+				break;
+			}
+			devs = tmp;
+			size += 16;
+		}
+		tmp = &devs[(*count)++];
+		tmp->pvt = pvt;
+		ast_copy_string(tmp->id, PVT_ID(pvt), sizeof(tmp->id));
+		pvt_status_get(pvt, &tmp->status);
+		pvt_state_get(pvt, &tmp->state);
+		tmp->sms_backlog = 0;
+		for (i = 0; i < backlogs; i++)
+		{
+			if (tmp->status.imsi[0] && !strcmp(backlog[i].dev, tmp->status.imsi))
+			{
+				tmp->sms_backlog = backlog[i].parts;
+				break;
+			}
+		}
+	}
+
+	return devs;
+}
+
+#/* */
+static struct ast_str * metrics_build(void)
+{
+	struct ast_str * out;
+	struct smsdb_backlog * backlog;
+	struct metrics_device * devs;
+	struct histogram hist;
+	struct histogram cmd_hist;
+	uint64_t value;
+	size_t count;
+	size_t i;
+	int backlogs;
+	unsigned k;
+	unsigned cmd;
+	char labels[64];
+
+	out = ast_str_create(16384);
+	if (!out)
+	{
+		return NULL;
+	}
+
+	/* before devices lock, dblock is never taken under it */
+	backlogs = smsdb_outgoing_backlog(&backlog);
+
+	/* readers only, monitor threads are not stopped */
+	AST_RWLIST_RDLOCK(&gpublic->devices);
+	devs = metrics_devices(backlog, backlogs, &count);
+	ast_free(backlog);
+
+	metrics_family(&out, "quectel_device_info", "Device identity and state", "gauge");
+	for (i = 0; i < count; i++)
+	{
+		ast_str_append(&out, 0, "quectel_device_info{device=\"");
+		metrics_escape(&out, devs[i].id);
+		ast_str_append(&out, 0, "\",state=\"");
+		metrics_escape(&out, devs[i].status.state ? devs[i].status.state : "");
+		ast_str_append(&out, 0, "\",model=\"");
+		metrics_escape(&out, devs[i].status.model);
+		ast_str_append(&out, 0, "\",firmware=\"");
+		metrics_escape(&out, devs[i].status.firmware);
+		ast_str_append(&out, 0, "\",provider=\"");
+		metrics_escape(&out, devs[i].status.provider_name);
+		ast_str_append(&out, 0, "\"} 1\n");
+	}
+
+	metrics_family(&out, "quectel_ready", "Device is ready for service", "gauge");
+	for (i = 0; i < count; i++)
+	{
+		metrics_sample(&out, "quectel_ready", &devs[i], "service=\"voice\"");
+		ast_str_append(&out, 0, "%d\n", devs[i].status.ready4voice);
+		metrics_sample(&out, "quectel_ready", &devs[i], "service=\"sms\"");
+		ast_str_append(&out, 0, "%d\n", devs[i].status.ready4sms);
+	}
+
+	metrics_family(&out, "quectel_rssi", "Signal strength as reported by +CSQ, 99 if unknown", "gauge");
+	for (i = 0; i < count; i++)
+	{
+		metrics_sample(&out, "quectel_rssi", &devs[i], NULL);
+		ast_str_append(&out, 0, "%d\n", devs[i].status.rssi);
+	}
+
+	metrics_family(&out, "quectel_registration_status", "GSM registration status as reported by +CREG", "gauge");
+	for (i = 0; i < count; i++)
+	{
+		metrics_sample(&out, "quectel_registration_status", &devs[i], NULL);
+		ast_str_append(&out, 0, "%d\n", devs[i].status.gsm_reg_status);
+	}
+
+	metrics_family(&out, "quectel_at_queue_tasks", "Tasks in AT queue", "gauge");
+	for (i = 0; i < count; i++)
+	{
+		metrics_sample(&out, "quectel_at_queue_tasks", &devs[i], NULL);
+		ast_str_append(&out, 0, "%u\n", PVT_STATE_T(&devs[i].state, at_tasks));
+	}
+
+	metrics_family(&out, "quectel_at_queue_commands", "Commands in AT queue", "gauge");
+	for (i = 0; i < count; i++)
+	{
+		metrics_sample(&out, "quectel_at_queue_commands", &devs[i], NULL);
+		ast_str_append(&out, 0, "%u\n", PVT_STATE_T(&devs[i].state, at_cmds));
+	}
+
+	metrics_family(&out, "quectel_channels", "Channels of device by call state", "gauge");
+	for (i = 0; i < count; i++)
+	{
+		for (k = 0; k < CALL_STATES_NUMBER; k++)
+		{
+			snprintf(labels, sizeof(labels), "state=\"%s\"", call_state2str(k));
+			metrics_sample(&out, "quectel_channels", &devs[i], labels);
+			ast_str_append(&out, 0, "%u\n", PVT_STATE_T(&devs[i].state, chan_count[k]));
+		}
+	}
+
+	metrics_family(&out, "quectel_sms_backlog_parts", "Outgoing SMS parts not confirmed by +CMGS", "gauge");
+	for (i = 0; i < count; i++)
+	{
+		metrics_sample(&out, "quectel_sms_backlog_parts", &devs[i], NULL);
+		ast_str_append(&out, 0, "%d\n", devs[i].sms_backlog);
+	}
+
+	for (k = 0; k < ITEMS_OF(metrics_counters); k++)
+	{
+		if (metrics_counters[k].help)
+		{
+			metrics_family(&out, metrics_counters[k].name, metrics_counters[k].help, "counter");
+		}
+		for (i = 0; i < count; i++)
+		{
+			metrics_sample(&out, metrics_counters[k].name, &devs[i], metrics_counters[k].labels);
+			ast_str_append(&out, 0, "%llu\n", (unsigned long long int) metrics_load(devs[i].pvt, metrics_counters[k].offset));
+		}
+	}
+
+	for (k = 0; k < ITEMS_OF(metrics_cmd_counters); k++)
+	{
+		metrics_family(&out, metrics_cmd_counters[k].name, metrics_cmd_counters[k].help, "counter");
+		for (i = 0; i < count; i++)
+		{
+			for (cmd = 0; cmd < AT_CMDS_NUMBER; cmd++)
+			{
+				value = metrics_load(devs[i].pvt, metrics_cmd_counters[k].offset + cmd * sizeof(uint64_t));
+				if (value == 0)
+				{
+					continue;
+				}
+				snprintf(labels, sizeof(labels), "command=\"%s\"", at_cmd2str(cmd));
+				metrics_sample(&out, metrics_cmd_counters[k].name, &devs[i], labels);
+				ast_str_append(&out, 0, "%llu\n", (unsigned long long int) value);
+			}
+		}
+	}
+
+	for (k = 0; k < ITEMS_OF(metrics_summaries); k++)
+	{
+		metrics_family(&out, metrics_summaries[k].name, metrics_summaries[k].help, "summary");
+		for (i = 0; i < count; i++)
+		{
+			if (metrics_summaries[k].offset == offsetof(pvt_stat_t, at_latency))
+			{
+				memset(&hist, 0, sizeof(hist));
+				for (cmd = 0; cmd < AT_CMDS_NUMBER; cmd++)
+				{
+					hist_copy(&cmd_hist, &devs[i].pvt->stat.at_latency[cmd]);
+					hist_merge(&hist, &cmd_hist);
+				}
+			}
+			else
+			{
+				hist_copy(&hist, (const struct histogram *) ((const char *) &devs[i].pvt->stat + metrics_summaries[k].offset));
+			}
+			metrics_summary(&out, metrics_summaries[k].name, &devs[i], &hist);
+		}
+	}
+	AST_RWLIST_UNLOCK(&gpublic->devices);
+	ast_free(devs);
+
+	return out;
+}
+
+#/* */
+static int metrics_http_callback(struct ast_tcptls_session_instance * ser, const struct ast_http_uri * urih, const char * uri,
+	enum ast_http_method method, struct ast_variable * get_params, struct ast_variable * headers)
+{
+	struct ast_str * http_header;
+	struct ast_str * out;
+
+	if (method != AST_HTTP_GET && method != AST_HTTP_HEAD)
+	{
+		ast_http_error(ser, 501, "Not Implemented", "Attempt to use unimplemented / unsupported method");
+		return 0;
+	}
+
+	http_header = ast_str_create(64);
+	out = metrics_build();
+	if (!http_header || !out)
+	{
+		ast_free(http_header);
+		ast_free(out);
+		ast_http_error(ser, 500, "Server Error", "Internal Server Error\nOut of memory\n");
+		return 0;
+	}
+
+	ast_str_set(&http_header, 0, "Content-Type: text/plain; version=0.0.4\r\n");
+	/* headers and body are freed by ast_http_send() */
+	ast_http_send(ser, method, 200, NULL, http_header, out, 0, 0);
+	return 0;
+}
+
+static struct ast_http_uri metrics_uri =
+{
+	.description = "Quectel device metrics in Prometheus format",
+	.uri = METRICS_URI,
+	.callback = metrics_http_callback,
+	.has_subtree = 0,
+	.data = NULL,
+	.key = __FILE__,
+};
+
+EXPORT_DEF void metrics_register()
+{
+	ast_http_uri_link(&metrics_uri);
+}
+
+EXPORT_DEF void metrics_unregister()
+{
+	ast_http_uri_unlink(&metrics_uri);
+}
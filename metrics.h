@@ -0,0 +1,18 @@
+/*
+ *
+ * This program is free software, distributed under the terms of
+ * the GNU General Public License Version 2. See the LICENSE file
+ * at the top of the source tree.
+ */
+#ifndef CHAN_QUECTEL_METRICS_H_INCLUDED
+#define CHAN_QUECTEL_METRICS_H_INCLUDED
+
+#include "export.h"			/* EXPORT_DECL EXPORT_DEF */
+
+/* path below Asterisk HTTP server prefix, e.g. http://host:8088/asterisk/quectel/metrics */
+#define METRICS_URI		"quectel/metrics"
+
+EXPORT_DECL void metrics_register();
+EXPORT_DECL void metrics_unregister();
+
+#endif /* CHAN_QUECTEL_METRICS_H_INCLUDED */
@@ -21,6 +21,7 @@ struct mixbuffer {
 	AST_LIST_HEAD_NOLOCK(,mixstream)	streams;	/*!< list of stream descriptions */
 	struct ringbuffer			rb;		/*!< base */
 	unsigned				attached;	/*!< number of attached streams */
+	size_t					limit;		/*!< max bytes buffered, may be less than rb.size */
 	};
 
 /* initialize mixbuffer */
@@ -29,6 +30,29 @@ INLINE_DECL void mixb_init(struct mixbuffer * mb, void * buf, size_t len)
 	AST_LIST_HEAD_INIT_NOLOCK(&mb->streams);
 	rb_init(&mb->rb, buf, len);
 	mb->attached = 0;
+	mb->limit = len;
+}
+
+/* initialize mixbuffer with mirrored ring buffer of len bytes, mapping is kept over calls; return 0 on success */
+INLINE_DECL int mixb_init_mirror(struct mixbuffer * mb, size_t len)
+{
+	if(!mb->rb.mirrored || mb->rb.size < len)
+	{
+		rb_fini(&mb->rb);
+		if(rb_init_mirror(&mb->rb, len))
+			return -1;
+	}
+	AST_LIST_HEAD_INIT_NOLOCK(&mb->streams);
+	mb->rb.used = mb->rb.read = mb->rb.write = 0;
+	mb->attached = 0;
+	mb->limit = len;
+	return 0;
+}
+
+/* release mapping of mixb_init_mirror() */
+INLINE_DECL void mixb_fini(struct mixbuffer * mb)
+{
+	rb_fini(&mb->rb);
 }
 
 /* attach stream to mix buffer */
@@ -40,7 +64,7 @@ EXPORT_DECL void mixb_detach(struct mixbuffer * mb, struct mixstream * stream);
 /* get amount of free bytes in buffer for specified stream */
 INLINE_DECL size_t mixb_free (const struct mixbuffer * mb, const struct mixstream * stream)
 {
-	return mb->rb.size - stream->used;
+	return mb->limit - stream->used;
 }
 
 /* get bytes used i.e. now may bytes can read */
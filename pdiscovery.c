@@ -8,6 +8,9 @@
 #include <stdio.h>			/* NULL */
 #include <string.h>			/* strlen() */
 #include <sys/stat.h>			/* stat() */
+#include <unistd.h>			/* access() */
+#include <poll.h>			/* poll() */
+#include <stdlib.h>			/* qsort() bsearch() */
 
 #include "pdiscovery.h"			/* pdiscovery_lookup()  */
 #include "mutils.h"			/* ITEMS_OF() */
@@ -16,6 +19,7 @@
 #include "at_read.h"			/* at_wait() at_read() at_read_result_iov() at_read_result_classification() */
 #include "chan_quectel.h"		/* opentty() closetty() */
 #include "manager.h"			/* manager_event_message_raw() */
+#include "smsdb.h"			/* smsdb_discovery_get() smsdb_discovery_put() smsdb_discovery_clear() smsdb_discovery_prune() */
 
 /*
 static const char sys_bus_usb_drivers_usb[] = "/sys/bus/usb/drivers/usb";
@@ -26,6 +30,12 @@ static const char sys_bus_usb_devices[] = "/sys/bus/usb/devices";
 /* timeout for port readering milliseconds */
 #define PDISCOVERY_TIMEOUT		500
 
+/* number of ports probed at same time by pdiscovery_refresh() */
+#define PDISCOVERY_PARALLEL		32
+
+
+/* voice is UAC sound card of device, no voice port */
+#define PDISCOVERY_IFACE_UAC		0xff
 
 struct pdiscovery_device {
 	u_int16_t	vendor_id;
@@ -33,6 +43,12 @@ struct pdiscovery_device {
 	u_int8_t	interfaces[INTERFACE_TYPE_NUMBERS];
 };
 
+/* device_ids and [usbports] of config, sorted by VID:PID */
+struct pdiscovery_device_map {
+	struct pdiscovery_device	* items;
+	unsigned			count;
+};
+
 struct pdiscovery_request {
 	const char	* name;
 	const char	* imei;
@@ -50,6 +66,22 @@ struct discovery_cache {
 	AST_RWLIST_HEAD (, pdiscovery_cache_item)  items;
 };
 
+/* port which IMEI/IMSI not in cache */
+struct pdiscovery_probe {
+	AST_LIST_ENTRY (pdiscovery_probe)	entry;
+	struct pdiscovery_result	res;
+	char				usb[SMSDB_USB_MAX_LEN];	/* USB device directory in sysfs */
+	char				identity[256];		/* ids and ports of device, see pdiscovery_probe_identity() */
+	char				* dlock;
+	char				* lock_file;
+	int				fd;
+	struct timeval			deadline;
+	struct ringbuffer		rb;
+	char				buf[1024 + 1];
+};
+
+AST_LIST_HEAD_NOLOCK (pdiscovery_probes, pdiscovery_probe);
+
 
 #define BUILD_NAME(d1, d2, d1len, d2len, out)		\
 		d2len = strlen(d2);			\
@@ -74,11 +106,17 @@ static const struct pdiscovery_device device_ids[] = {
 
 static struct discovery_cache cache;
 
+static struct pdiscovery_device_map device_map;
+static int device_map_configured;	/* map was loaded from config, see pdiscovery_config() */
+AST_RWLOCK_DEFINE_STATIC(device_map_lock);
+
 #/* return non-0 if all ports matched */
 static int ports_match(const struct pdiscovery_ports * p1, const struct pdiscovery_ports * p2)
 {
 	unsigned i;
 	for(i = 0; i < ITEMS_OF(p1->ports); i++) {
+		if(!p1->ports[i] && !p2->ports[i])
+			continue;
 		if(!p1->ports[i] || ! p2->ports[i] || strcmp(p1->ports[i], p2->ports[i]) != 0)
 			return 0;
 	}
@@ -203,22 +241,6 @@ static struct pdiscovery_cache_item * cache_search(struct discovery_cache * cach
 }
 
 
-#/* */
-static int cache_lookup(struct discovery_cache * cache, const struct pdiscovery_request * req, struct pdiscovery_result * res, int * failed)
-{
-	int found = 0;
-	struct pdiscovery_cache_item * item = cache_search(cache, res);
-	if(item) {
-		res->imei = item->res.imei ? ast_strdup(item->res.imei) : NULL;
-		res->imsi = item->res.imsi ? ast_strdup(item->res.imsi) : NULL;
-		found = item->status || ((req->imei || item->res.imei) && (req->imsi || item->res.imsi));
-		if(found) {
-			*failed = item->status;
-		}
-	}
-	return found;
-}
-
 #/* */
 static void cache_update(struct discovery_cache * cache, const struct pdiscovery_result * res, int status)
 {
@@ -227,7 +249,11 @@ static void cache_update(struct discovery_cache * cache, const struct pdiscovery
 		cache_item_update(item, res, status);
 	} else {
 		item = cache_item_create(res, status);
-		AST_LIST_INSERT_TAIL(&cache->items, item, entry);
+		if(item) {
+			AST_RWLIST_WRLOCK(&cache->items);
+			AST_LIST_INSERT_TAIL(&cache->items, item, entry);
+			AST_RWLIST_UNLOCK(&cache->items);
+		}
 	}
 }
 
@@ -240,7 +266,7 @@ static void cache_init(struct discovery_cache * cache)
 }
 
 #/* */
-static void cache_fini(struct discovery_cache * cache)
+static void cache_clear(struct discovery_cache * cache)
 {
 	struct pdiscovery_cache_item * item;
 
@@ -251,7 +277,12 @@ static void cache_fini(struct discovery_cache * cache)
 	}
 	AST_LIST_TRAVERSE_SAFE_END;
 	AST_RWLIST_UNLOCK(&cache->items);
+}
 
+#/* */
+static void cache_fini(struct discovery_cache * cache)
+{
+	cache_clear(cache);
 	AST_RWLIST_HEAD_DESTROY(&cache->items);
 }
 
@@ -403,21 +434,87 @@ static int pdiscovery_interfaces(const char * devname, const char * name, int le
 
 
 #/* */
-static const struct pdiscovery_device * pdiscovery_lookup_ids(const char * devname, const char * name, int len)
+static int device_cmp(const void * p1, const void * p2)
+{
+	const struct pdiscovery_device * d1 = p1;
+	const struct pdiscovery_device * d2 = p2;
+
+	if(d1->vendor_id != d2->vendor_id)
+		return d1->vendor_id < d2->vendor_id ? -1 : 1;
+	if(d1->product_id != d2->product_id)
+		return d1->product_id < d2->product_id ? -1 : 1;
+	return 0;
+}
+
+#/* add or replace item of map, map items must have space for one more */
+static void device_map_set(struct pdiscovery_device_map * map, const struct pdiscovery_device * device)
+{
+	struct pdiscovery_device * found = bsearch(device, map->items, map->count, sizeof(*device), device_cmp);
+
+	if(found) {
+		*found = *device;
+	} else {
+		map->items[map->count++] = *device;
+		qsort(map->items, map->count, sizeof(*device), device_cmp);
+	}
+}
+
+#/* replace map, old one is freed, return non-zero if items differ */
+static int device_map_swap(struct pdiscovery_device_map * map)
+{
+	struct pdiscovery_device_map old;
+	int changed;
+
+	ast_rwlock_wrlock(&device_map_lock);
+	old = device_map;
+	device_map = *map;
+	ast_rwlock_unlock(&device_map_lock);
+
+	changed = old.count != map->count || (map->count && memcmp(old.items, map->items, map->count * sizeof(*map->items)) != 0);
+	ast_free(old.items);
+	return changed;
+}
+
+#/* map with device_ids only */
+static int device_map_builtin(struct pdiscovery_device_map * map, unsigned extra)
+{
+	unsigned idx;
+
+	map->count = 0;
+	map->items = ast_calloc(ITEMS_OF(device_ids) + extra, sizeof(*map->items));
+	if(!map->items)
+		return -1;
+	for(idx = 0; idx < ITEMS_OF(device_ids); idx++)
+		device_map_set(map, &device_ids[idx]);
+	return 0;
+}
+
+#/* return non-zero if device found and copied */
+static int pdiscovery_lookup_ids(const char * devname, const char * name, int len, struct pdiscovery_device * device)
 {
 	unsigned vid;
 	unsigned pid;
-	unsigned idx;
+	const struct pdiscovery_device * found = NULL;
 
 	if(pdiscovery_get_id(name, len, "idVendor", &vid) == 1 && pdiscovery_get_id(name, len, "idProduct", &pid) == 1) {
 		ast_debug(4, "[%s discovery] found %s is idVendor %04x idProduct %04x\n", devname, name, vid, pid);
-		for(idx = 0; idx < ITEMS_OF(device_ids); idx++) {
-			if(device_ids[idx].vendor_id == vid && device_ids[idx].product_id == pid) {
-				return &device_ids[idx];
-				}
-		}
+		device->vendor_id = vid;
+		device->product_id = pid;
+
+		ast_rwlock_rdlock(&device_map_lock);
+		found = bsearch(device, device_map.items, device_map.count, sizeof(*device), device_cmp);
+		if(found)
+			*device = *found;
+		ast_rwlock_unlock(&device_map_lock);
 	}
-	return NULL;
+	return found != NULL;
+}
+
+#/* return non-zero if all ports of device found */
+static int pdiscovery_ports_complete(const struct pdiscovery_device * device, const struct pdiscovery_ports * ports)
+{
+	return ports->ports[INTERFACE_TYPE_DATA]
+		&& (ports->ports[INTERFACE_TYPE_VOICE] || device->interfaces[INTERFACE_TYPE_VOICE] == PDISCOVERY_IFACE_UAC);
 }
 
 #/* 0D 0A IMEI: <15 digits> 0D 0A */
@@ -487,245 +584,394 @@ static int pdiscovery_handle_response(const struct pdiscovery_request * req, con
 	return done;
 }
 
-
-#/* return zero on sucess */
-static int pdiscovery_do_cmd(const struct pdiscovery_request * req, int fd, const char * name, const char * cmd, unsigned length, struct pdiscovery_result * res)
+#/* */
+static void pdiscovery_probe_free(struct pdiscovery_probe * probe)
 {
-	int timeout;
-	char buf[1024 + 1];
-	struct ringbuffer rb;
-	struct iovec iov[2];
-	int iovcnt;
-	size_t wrote;
+	result_free(&probe->res);
+	ast_free(probe);
+}
 
-	ast_debug(4, "[%s discovery] use %s for IMEI/IMSI discovery\n", req->name, name);
+/*!
+ * \brief Describe device for persistent cache
+ *
+ * devnum changes each time device is enumerated, so after USB reset or
+ * replug stored IMEI/IMSI are not trusted and port is probed again.
+ */
+#/* */
+static void pdiscovery_probe_identity(const char * name, int len, const struct pdiscovery_device * device, struct pdiscovery_probe * probe)
+{
+	unsigned devnum = 0;
 
-	clean_read_data(req->name, fd);
-	wrote = write_all(fd, cmd, length);
-	if(wrote == length) {
-		timeout = PDISCOVERY_TIMEOUT;
-		rb_init(&rb, buf, sizeof(buf) - 1);
-		while(timeout > 0 && at_wait(fd, &timeout) != 0) {
-			iovcnt = at_read(fd, name, &rb);
-			if(iovcnt > 0) {
-				iovcnt = rb_read_all_iov(&rb, iov);
-				if(pdiscovery_handle_response(req, iov, iovcnt, res))
-					return 0;
-			} else {
-				snprintf(buf, sizeof(buf), "Read Failed\r\nErrorCode: %d", errno);
-				manager_event_message_raw("QuectelPortFail", name, buf);
-				ast_log (LOG_ERROR, "[%s discovery] read from %s failed: %s\n", req->name, name, strerror(errno));
-				return -1;
-			}
-		}
-		manager_event_message_raw("QuectelPortFail", name, "Response Failed");
-		ast_log (LOG_ERROR, "[%s discovery] failed to get valid response from %s in %d msec\n", req->name, name, PDISCOVERY_TIMEOUT);
-	} else {
-		snprintf(buf, sizeof(buf), "Write Failed\r\nErrorCode: %d", errno);
-		manager_event_message_raw("QuectelPortFail", name, buf);
-		ast_log (LOG_ERROR, "[%s discovery] write to %s failed: %s\n", req->name, name, strerror(errno));
-	}
-	return 1;
+	pdiscovery_get_id(name, len, "devnum", &devnum);
+	snprintf(probe->identity, sizeof(probe->identity), "%04x:%04x %x %s %s",
+		device->vendor_id, device->product_id, devnum,
+		probe->res.ports.ports[INTERFACE_TYPE_DATA],
+		S_OR(probe->res.ports.ports[INTERFACE_TYPE_VOICE], "uac"));
 }
 
-#/* return non-zero on fail */
-static int pdiscovery_get_info(const char * port, const struct pdiscovery_request * req, struct pdiscovery_result * res)
+#/* take IMEI/IMSI stored by previous run, return non-zero if found */
+static int pdiscovery_probe_stored(struct pdiscovery_probe * probe)
 {
-	static const struct {
-		const char	* cmd;
-		unsigned	length;
-	} cmds[] = {
-		{ "AT+CIMI\r", 8 },		/* IMSI */
-		{ "AT+GSN\r", 7 },			/* IMEI */
-		{ "AT+GSN; +CIMI\r" , 14 },	/* IMSI + IMEI */
-	};
+	char imei[IMEI_SIZE + 1];
+	char imsi[IMSI_SIZE + 1];
 
-	static const int want_map[2][2] = {
-		{ 2, 0 },	// want_imei = 0
-		{ 1, 2 }	// want_imei = 1
-	};
+	if(!smsdb_discovery_get(probe->usb, probe->identity, imei, sizeof(imei), imsi, sizeof(imsi)))
+		return 0;
 
-	int fail = 1;
-	char * lock_file;
+	ast_debug(4, "[probe discovery] %s use stored IMEI %s IMSI %s\n", probe->res.ports.ports[INTERFACE_TYPE_DATA], imei, imsi);
+	probe->res.imei = imei[0] ? ast_strdup(imei) : NULL;
+	probe->res.imsi = imsi[0] ? ast_strdup(imsi) : NULL;
+	cache_update(&cache, &probe->res, 0);
+	return 1;
+}
 
-	int fd = opentty(port, &lock_file, 0);
-	if(fd >= 0) {
-		unsigned want_imei = req->imei && res->imei == NULL;		// 1 && 0
-		unsigned want_imsi = req->imsi && res->imsi == NULL;		// 1 && 1
-		unsigned cmd = want_map[want_imei][want_imsi];
+#/* collect ports of all known devices missing in cache */
+static void pdiscovery_probe_collect(const char * name, int len, struct pdiscovery_probes * probes)
+{
+	int len2;
+	char * name2;
+	struct pdiscovery_device device;
+	struct pdiscovery_probe * probe = NULL;
+	struct dirent * dentry;
+	DIR * dir = opendir(name);
 
-		/* clean queue first ? */
-		fail = pdiscovery_do_cmd(req, fd, port, cmds[cmd].cmd, cmds[cmd].length, res);
-		closetty(fd, &lock_file);
+	if(!dir)
+		return;
+
+	while((dentry = readdir(dir)) != NULL) {
+		if(strcmp(dentry->d_name, ".") == 0 || strcmp(dentry->d_name, "..") == 0 || strstr(dentry->d_name, "usb") == dentry->d_name)
+			continue;
+
+		BUILD_NAME(name, dentry->d_name, len, len2, name2);
+		if(!pdiscovery_lookup_ids("probe", name2, len2, &device))
+			continue;
+
+		if(!probe && !(probe = ast_calloc(1, sizeof(*probe))))
+			break;
+		pdiscovery_interfaces("probe", name2, len2, &device, &probe->res.ports);
+		if(pdiscovery_ports_complete(&device, &probe->res.ports)
+			&& cache_search(&cache, &probe->res) == NULL) {
+			ast_copy_string(probe->usb, dentry->d_name, sizeof(probe->usb));
+			pdiscovery_probe_identity(name2, len2, &device, probe);
+			if(!pdiscovery_probe_stored(probe)) {
+				probe->fd = -1;
+				AST_LIST_INSERT_TAIL(probes, probe, entry);
+				probe = NULL;
+				continue;
+			}
+		}
+		result_free(&probe->res);
 	}
+	closedir(dir);
 
-	return fail;
+	if(probe)
+		pdiscovery_probe_free(probe);
 }
 
-#/* return non-zero on fail */
-static int pdiscovery_get_info_cached(const char * port, const struct pdiscovery_request * req, struct pdiscovery_result * res)
+#/* send request to port, return zero on sucess */
+static int pdiscovery_probe_start(struct pdiscovery_probe * probe)
 {
-	int fail = 1;
-	/* may add info also if !found */
-	int found = cache_lookup(&cache, req, res, &fail);
-	if(!found) {
-		fail = pdiscovery_get_info(port, req, res);
-		cache_update(&cache, res, fail);
-	} else {
-		ast_debug(4, "[%s discovery] %s use cached IMEI %s IMSI %s failed %d\n", req->name, port, S_OR(res->imei, ""), S_OR(res->imsi, ""), fail);
-	}
+	static const char cmd[] = "AT+GSN; +CIMI\r";	/* IMSI + IMEI */
+	const char * port = probe->res.ports.ports[INTERFACE_TYPE_DATA];
+	int pid;
+	char buf[64];
 
-	return fail;
-}
+	pid = lock_try(port, &probe->dlock);
+	if(pid != 0) {
+		ast_debug(4, "[probe discovery] %s already used by process %d, skipped\n", port, pid);
+		return -1;
+	}
 
-#/* return zero on success */
-static int pdiscovery_read_info(const struct pdiscovery_request * req, struct pdiscovery_result * res)
-{
+	probe->fd = opentty(port, &probe->lock_file, 0);
+	if(probe->fd < 0) {
+		cache_update(&cache, &probe->res, 1);
+		return -1;
+	}
 
-	char * dlock;
-	int fail = 1;
+	ast_debug(4, "[probe discovery] use %s for IMEI/IMSI discovery\n", port);
+	clean_read_data(port, probe->fd);
+	if(write_all(probe->fd, cmd, STRLEN(cmd)) != STRLEN(cmd)) {
+		snprintf(buf, sizeof(buf), "Write Failed\r\nErrorCode: %d", errno);
+		manager_event_message_raw("QuectelPortFail", port, buf);
+		ast_log (LOG_ERROR, "[probe discovery] write to %s failed: %s\n", port, strerror(errno));
+		cache_update(&cache, &probe->res, 1);
+		return -1;
+	}
 
-//	const char * cport = res->ports.ports[INTERFACE_TYPE_COM];
-	const char * dport = res->ports.ports[INTERFACE_TYPE_DATA];
+	rb_init(&probe->rb, probe->buf, sizeof(probe->buf) - 1);
+	probe->deadline = ast_tvadd(ast_tvnow(), ast_tv(0, PDISCOVERY_TIMEOUT * 1000));
+	return 0;
+}
 
-//	if(cport && strcmp(cport, dport) != 0) {
-		int pid = lock_try(dport, &dlock);
-		if(pid == 0) {
-			fail = pdiscovery_get_info_cached(dport, req, res);
-			closetty(-1, &dlock);
-		} else {
-			ast_debug(4, "[%s discovery] %s already used by process %d, skipped\n", req->name, dport, pid);
-//			ast_log (LOG_WARNING, "[%s discovery] %s already used by process %d\n", devname, dport, pid);
+#/* read response, return non-zero when probe is finished and cached */
+static int pdiscovery_probe_read(struct pdiscovery_probe * probe)
+{
+	static const struct pdiscovery_request req = {
+		"probe",
+		"ANY",
+		"ANY",
+	};
+	const char * port = probe->res.ports.ports[INTERFACE_TYPE_DATA];
+	struct iovec iov[2];
+	int iovcnt;
+	char buf[64];
+
+	iovcnt = at_read(probe->fd, port, &probe->rb);
+	if(iovcnt > 0) {
+		iovcnt = rb_read_all_iov(&probe->rb, iov);
+		if(pdiscovery_handle_response(&req, iov, iovcnt, &probe->res)) {
+			cache_update(&cache, &probe->res, 0);
+			smsdb_discovery_put(probe->usb, probe->identity, probe->res.imei, probe->res.imsi);
+			return 1;
 		}
-//	} else {
-//		fail = pdiscovery_get_info_cached(dport, req, res);
-//	}
-	return fail;
+		return 0;
+	}
+
+	snprintf(buf, sizeof(buf), "Read Failed\r\nErrorCode: %d", errno);
+	manager_event_message_raw("QuectelPortFail", port, buf);
+	ast_log (LOG_ERROR, "[probe discovery] read from %s failed: %s\n", port, strerror(errno));
+	cache_update(&cache, &probe->res, -1);
+	return 1;
 }
 
 #/* */
-static int pdiscovery_check_req(const struct pdiscovery_request * req, struct pdiscovery_result * res)
+static void pdiscovery_probe_finish(struct pdiscovery_probe * probe)
 {
-	int match = 0;
-	if(pdiscovery_read_info(req, res) == 0) {
-
-		match = ((req->imei == 0) || (res->imei && strcmp(req->imei, res->imei) == 0))
-			&&
-			((req->imsi == 0) || (res->imsi && strcmp(req->imsi, res->imsi) == 0));
-
-		ast_debug(4, "[%s discovery] %smatched IMEI=%s/%s IMSI=%s/%s\n",
-			req->name,
-			match ? "" : "un" ,
-			S_OR(req->imei, "") , S_OR(res->imei, ""),
-			S_OR(req->imsi, ""),  S_OR(res->imsi, "")
-			);
-	}
-
-	return match;
+	if(probe->fd >= 0)
+		closetty(probe->fd, &probe->lock_file);
+	if(probe->dlock)
+		closetty(-1, &probe->dlock);
+	pdiscovery_probe_free(probe);
 }
 
 #/* */
-static int pdiscovery_check_device(const char * name, int len, const char * subdir, const struct pdiscovery_request * req, struct pdiscovery_result * res)
+static int pdiscovery_usb_exists(const char * usb)
 {
 	int len2;
 	char * name2;
-	const struct pdiscovery_device * device;
-	int found = 0;
 
-	BUILD_NAME(name, subdir, len, len2, name2);
+	BUILD_NAME(sys_bus_usb_devices, usb, STRLEN(sys_bus_usb_devices), len2, name2);
+	return access(name2, F_OK) == 0;
+}
+
+/*!
+ * \brief Query IMEI and IMSI of all ports missing in cache at once
+ *
+ * Up to PDISCOVERY_PARALLEL ports are queried together from one poll() loop,
+ * each with own PDISCOVERY_TIMEOUT, so cold start of many modems takes about
+ * one timeout instead of one per modem. Results go to cache where
+ * pdiscovery_lookup() finds them, answers are also kept in smsdb so
+ * next start probes only devices which changed.
+ *
+ * Called once at start of discovery pass, not per device. Stored IMEI/IMSI
+ * of unplugged devices are dropped from smsdb here too.
+ */
+#/* */
+EXPORT_DEF void pdiscovery_refresh()
+{
+	struct pdiscovery_probes pending;
+	struct pdiscovery_probe * active[PDISCOVERY_PARALLEL];
+	struct pollfd fds[PDISCOVERY_PARALLEL];
+	struct pdiscovery_probe * probe;
+	struct timeval now;
+	int nactive = 0;
+	int timeout;
+	int idx;
 
-	device = pdiscovery_lookup_ids(req->name, name2, len2);
-	if(device) {
-//		ast_debug(4, "[%s discovery] should ports <-> interfaces map for %04x:%04x modem=%02x voice=%02x data=%02x\n",
-		ast_debug(4, "[%s discovery] should ports <-> interfaces map for %04x:%04x voice=%02x data=%02x\n",
-			req->name,
-			device->vendor_id,
-			device->product_id,
-//			device->interfaces[INTERFACE_TYPE_COM],
-			device->interfaces[INTERFACE_TYPE_VOICE],
-			device->interfaces[INTERFACE_TYPE_DATA]
-			);
-		pdiscovery_interfaces(req->name, name2, len2, device, &res->ports);
-
-		/* check mandatory ports */
-		if(res->ports.ports[INTERFACE_TYPE_DATA] && res->ports.ports[INTERFACE_TYPE_VOICE]) {
-			found = pdiscovery_check_req(req, res);
+	AST_LIST_HEAD_INIT_NOLOCK(&pending);
+	smsdb_discovery_prune(pdiscovery_usb_exists);
+	pdiscovery_probe_collect(sys_bus_usb_devices, STRLEN(sys_bus_usb_devices), &pending);
+
+	while(nactive > 0 || !AST_LIST_EMPTY(&pending)) {
+		/* fill free slots */
+		while(nactive < PDISCOVERY_PARALLEL && (probe = AST_LIST_REMOVE_HEAD(&pending, entry)) != NULL) {
+			if(pdiscovery_probe_start(probe) == 0) {
+				active[nactive++] = probe;
+			} else {
+				pdiscovery_probe_finish(probe);
+			}
 		}
-	}
+		if(nactive == 0)
+			break;
 
-	if(!found)
-		result_free(res);
-	return found;
-}
+		now = ast_tvnow();
+		timeout = PDISCOVERY_TIMEOUT;
+		for(idx = 0; idx < nactive; idx++) {
+			fds[idx].fd = active[idx]->fd;
+			fds[idx].events = POLLIN;
+			fds[idx].revents = 0;
+			timeout = MIN(timeout, (int) ast_tvdiff_ms(active[idx]->deadline, now));
+		}
 
-#/* */
-static int pdiscovery_request_do(const char * name, int len, const struct pdiscovery_request * req, struct pdiscovery_result * res)
-{
-	int found = 0;
-	struct dirent * dentry;
-	DIR * dir = opendir(name);
-	if(dir) {
-		while((dentry = readdir(dir)) != NULL) {
-			if(strcmp(dentry->d_name, ".") != 0 && strcmp(dentry->d_name, "..") != 0 && strstr(dentry->d_name, "usb") != dentry->d_name) {
-				ast_debug(4, "[%s discovery] checking %s/%s\n", req->name, name, dentry->d_name);
-				found = pdiscovery_check_device(name, len, dentry->d_name, req, res);
-				if(found)
-					break;
+		if(poll(fds, nactive, timeout > 0 ? timeout : 0) < 0 && errno != EINTR) {
+			ast_log (LOG_ERROR, "[probe discovery] poll() failed: %s\n", strerror(errno));
+			break;
+		}
+
+		now = ast_tvnow();
+		for(idx = nactive - 1; idx >= 0; idx--) {
+			probe = active[idx];
+			if(fds[idx].revents && pdiscovery_probe_read(probe)) {
+				/* answered or failed */
+			} else if(ast_tvcmp(now, probe->deadline) < 0) {
+				continue;
+			} else {
+				manager_event_message_raw("QuectelPortFail", probe->res.ports.ports[INTERFACE_TYPE_DATA], "Response Failed");
+				ast_log (LOG_ERROR, "[probe discovery] failed to get valid response from %s in %d msec\n", probe->res.ports.ports[INTERFACE_TYPE_DATA], PDISCOVERY_TIMEOUT);
+				cache_update(&cache, &probe->res, 1);
 			}
+			pdiscovery_probe_finish(probe);
+			active[idx] = active[--nactive];
 		}
-		closedir(dir);
 	}
-	return found;
-}
 
+	for(idx = 0; idx < nactive; idx++)
+		pdiscovery_probe_finish(active[idx]);
+	while((probe = AST_LIST_REMOVE_HEAD(&pending, entry)) != NULL)
+		pdiscovery_probe_finish(probe);
+}
 
 #/* */
 EXPORT_DEF void pdiscovery_init()
 {
+	struct pdiscovery_device_map map;
+
 	cache_init(&cache);
+	if(device_map_builtin(&map, 0) == 0)
+		device_map_swap(&map);
 }
 
 #/* */
 EXPORT_DEF void pdiscovery_fini()
 {
+	struct pdiscovery_device_map map = { NULL, 0 };
+
+	device_map_swap(&map);
+	device_map_configured = 0;
 	cache_fini(&cache);
 }
 
+/*!
+ * \brief Load USB port map from config
+ * \param cfg -- config
+ * \param cat -- section with "<vid>:<pid> = <data interface>,<voice interface or uac>" entries
+ *
+ * Entries are added to or replace ones compiled in device_ids, map is
+ * rebuilt on each call so removed entries are forgotten on reload. When
+ * map changed on reload, ports and IMEI/IMSI found with old one are
+ * dropped from cache and smsdb.
+ */
+EXPORT_DEF void pdiscovery_config(struct ast_config * cfg, const char * cat)
+{
+	struct pdiscovery_device_map map;
+	struct pdiscovery_device device;
+	struct ast_variable * v;
+	unsigned count = 0;
+	unsigned vid, pid, data, voice;
+	char uac[4];
+
+	for(v = ast_variable_browse(cfg, cat); v; v = v->next)
+		count++;
+
+	if(device_map_builtin(&map, count))
+		return;
+
+	for(v = ast_variable_browse(cfg, cat); v; v = v->next) {
+		if(sscanf(v->name, "%x:%x", &vid, &pid) != 2 || vid > 0xffff || pid > 0xffff) {
+			ast_log(LOG_ERROR, "[%s] bad USB id '%s' at line %d, expected <vid>:<pid>\n", cat, v->name, v->lineno);
+			continue;
+		}
+		if(sscanf(v->value, "%u , %3[uac]", &data, uac) == 2 && strcmp(uac, "uac") == 0) {
+			voice = PDISCOVERY_IFACE_UAC;
+		} else if(sscanf(v->value, "%u , %u", &data, &voice) != 2 || voice >= PDISCOVERY_IFACE_UAC) {
+			ast_log(LOG_ERROR, "[%s] bad interfaces '%s' of %s at line %d, expected <data>,<voice> or <data>,uac\n", cat, v->value, v->name, v->lineno);
+			continue;
+		}
+		if(data >= PDISCOVERY_IFACE_UAC) {
+			ast_log(LOG_ERROR, "[%s] bad data interface %u of %s at line %d\n", cat, data, v->name, v->lineno);
+			continue;
+		}
+
+		device.vendor_id = vid;
+		device.product_id = pid;
+		device.interfaces[INTERFACE_TYPE_DATA] = data;
+		device.interfaces[INTERFACE_TYPE_VOICE] = voice;
+		device_map_set(&map, &device);
+	}
+
+	ast_debug(1, "USB port map has %u devices\n", map.count);
+	if(device_map_swap(&map) && device_map_configured) {
+		ast_verb(3, "USB port map changed, discovery of all devices is repeated\n");
+		cache_clear(&cache);
+		smsdb_discovery_clear();
+	}
+	device_map_configured = 1;
+}
+
 #/* */
 EXPORT_DEF int pdiscovery_lookup(const char * devname, const char * imei, const char * imsi, char ** dport, char ** aport)
 {
-	int found;
-	struct pdiscovery_result res;
-	const struct pdiscovery_request req = {
-		devname,
-		((imei && imei[0]) ? imei : NULL),
-		((imsi && imsi[0]) ? imsi : NULL),
-		};
+	int found = 0;
+	const struct pdiscovery_cache_item * item;
+	struct timeval now = ast_tvnow();
 
-	memset(&res, 0, sizeof(res));
-	found = pdiscovery_request_do(sys_bus_usb_devices, STRLEN(sys_bus_usb_devices), &req, &res);
-	if(found) {
-		*dport = ast_strdup(res.ports.ports[INTERFACE_TYPE_DATA]);
-		*aport = ast_strdup(res.ports.ports[INTERFACE_TYPE_VOICE]);
+	imei = (imei && imei[0]) ? imei : NULL;
+	imsi = (imsi && imsi[0]) ? imsi : NULL;
+
+	/* only cache is read, pdiscovery_refresh() fills it */
+	AST_RWLIST_RDLOCK(&cache.items);
+	AST_LIST_TRAVERSE(&cache.items, item, entry) {
+		if(item->status != 0 || ast_tvcmp(now, item->validtill) >= 0)
+			continue;
+
+		found = (imei == NULL || (item->res.imei && strcmp(imei, item->res.imei) == 0))
+			&& (imsi == NULL || (item->res.imsi && strcmp(imsi, item->res.imsi) == 0));
+		if(found) {
+			*dport = ast_strdup(item->res.ports.ports[INTERFACE_TYPE_DATA]);
+			*aport = ast_strdup(S_OR(item->res.ports.ports[INTERFACE_TYPE_VOICE], ""));
+			break;
+		}
 	}
-	result_free(&res);
+	AST_RWLIST_UNLOCK(&cache.items);
+
+	ast_debug(4, "[%s discovery] IMEI=%s IMSI=%s %s\n", devname, S_OR(imei, ""), S_OR(imsi, ""), found ? *dport : "not found");
 	return found;
 }
 
+/*!
+ * \brief Drop cached and stored ports of device found by IMEI or IMSI
+ *
+ * Used when device reports other IMEI/IMSI than it was discovered by, e.g.
+ * SIM card swapped while powered off, so next pass probes its ports again.
+ */
+#/* */
+EXPORT_DEF void pdiscovery_forget(const char * imei, const char * imsi)
+{
+	struct pdiscovery_cache_item * item;
+
+	imei = (imei && imei[0]) ? imei : NULL;
+	imsi = (imsi && imsi[0]) ? imsi : NULL;
+
+	AST_RWLIST_WRLOCK(&cache.items);
+	AST_LIST_TRAVERSE_SAFE_BEGIN(&cache.items, item, entry) {
+		if((imei && item->res.imei && strcmp(imei, item->res.imei) == 0)
+			|| (imsi && item->res.imsi && strcmp(imsi, item->res.imsi) == 0)) {
+			AST_LIST_REMOVE_CURRENT(entry);
+			cache_item_free(item);
+		}
+	}
+	AST_LIST_TRAVERSE_SAFE_END;
+	AST_RWLIST_UNLOCK(&cache.items);
+
+	smsdb_discovery_forget(imei, imsi);
+}
+
 #/* */
 EXPORT_DEF const struct pdiscovery_result * pdiscovery_list_begin(const struct pdiscovery_cache_item ** opaque)
 {
 	const struct pdiscovery_cache_item * item;
-	struct pdiscovery_result res;
-	const struct pdiscovery_request req = {
-		"list",
-		"ANY",
-		"ANY",
-		};
 
-	memset(&res, 0, sizeof(res));
-	pdiscovery_request_do(sys_bus_usb_devices, STRLEN(sys_bus_usb_devices), &req, &res);
-	result_free(&res);
+	pdiscovery_refresh();
 
 	*opaque = item = cache_first_readlock(&cache);
 	return item != NULL ? &item->res : NULL;
@@ -24,11 +24,15 @@ struct pdiscovery_result {
 };
 
 struct pdiscovery_cache_item;
+struct ast_config;
 
 EXPORT_DECL void pdiscovery_init();
 EXPORT_DECL void pdiscovery_fini();
-/* return non-zero if found */
+EXPORT_DECL void pdiscovery_config(struct ast_config * cfg, const char * cat);
+EXPORT_DECL void pdiscovery_refresh();
+/* return non-zero if found, only cached ports are searched */
 EXPORT_DECL int pdiscovery_lookup(const char * device, const char * imei, const char * imsi, char ** dport, char ** aport);
+EXPORT_DECL void pdiscovery_forget(const char * imei, const char * imsi);
 EXPORT_DECL const struct pdiscovery_result * pdiscovery_list_begin(const struct pdiscovery_cache_item ** opaque);
 EXPORT_DECL const struct pdiscovery_result * pdiscovery_list_next(const struct pdiscovery_cache_item ** opaque);
 EXPORT_DECL void pdiscovery_list_end();
@@ -9,8 +9,8 @@
 
 #include "pdu.h"
 #include "helpers.h"			/* dial_digit_code() */
+#include "mutils.h"			/* ITEMS_OF() */
 #include "char_conv.h"			/* utf8_to_hexstr_ucs2() */
-#include "gsm7_luts.h"
 #include "error.h"
 
 /* SMS-SUBMIT format
@@ -263,10 +263,10 @@
 #define ROUND_UP2(x)				(((x) + 1) & (0xFFFFFFFF << 1))
 #define DIV2UP(x)			(((x) + 1)/2)
 
-#define CSMS_GSM7_MAX_LEN 153
+#define DIV7UP(x)			(((x) + 6)/7)
+
+#define SMS_UD_MAX_LEN 140
 #define SMS_GSM7_MAX_LEN 160
-#define CSMS_UCS2_MAX_LEN 67
-#define SMS_UCS2_MAX_LEN 70
 
 EXPORT_DEF void pdu_udh_init(pdu_udh_t *udh)
 {
@@ -460,88 +460,185 @@ static int pdu_parse_timestamp(uint8_t *pdu, size_t length, char *out)
 	return -1;
 }
 
-EXPORT_DEF int pdu_build_mult(pdu_part_t *pdus, const char *sca, const char *dst, const uint16_t* msg, size_t msg_len, unsigned valid_minutes, int srr, uint8_t csmsref)
+#/* length of UDH in octets including UDHL, 0 if no header is needed */
+static unsigned pdu_udh_length(int concat, uint8_t ls, uint8_t ss)
 {
-	uint16_t msg_gsm7[msg_len];
-	int gsm7_len = gsm7_encode(msg, msg_len, msg_gsm7);
-
-	unsigned split = 0;
-	unsigned cnt = 0, i = 0, off = 0;
-	if (gsm7_len >= 0) {
-		if (gsm7_len > SMS_GSM7_MAX_LEN) {
-			split = CSMS_GSM7_MAX_LEN;
-		} else {
-			split = SMS_GSM7_MAX_LEN;
-		}
-		while (off < msg_len) {
-			unsigned septets = 0, n;
-			for (n = 0; off + n < msg_len; ++n) {
-				unsigned req = msg_gsm7[off + n] > 255 ? 2 : 1;
-				if (septets + req >= split) {
-					break;
+	unsigned len = (concat ? 5 : 0) + (ls ? 3 : 0) + (ss ? 3 : 0);
+	return len ? len + 1 : 0;
+}
+
+#/* septets of user data left for a GSM7 part with given header */
+static unsigned pdu_gsm7_capacity(int concat, uint8_t ls, uint8_t ss)
+{
+	return SMS_GSM7_MAX_LEN - DIV7UP(pdu_udh_length(concat, ls, ss) * 8);
+}
+
+#/* */
+static unsigned pdu_gsm7_parts(unsigned septets, uint8_t ls, uint8_t ss)
+{
+	unsigned cap;
+
+	/* a part is closed before its capacity is reached */
+	if (septets < pdu_gsm7_capacity(0, ls, ss)) {
+		return 1;
+	}
+	cap = pdu_gsm7_capacity(1, ls, ss) - 1;
+	return (septets + cap - 1) / cap;
+}
+
+/*!
+ * \brief Start segmentation of a message into SMS-SUBMIT PDUs
+ * \param iter -- iterator to initialize, msg must stay valid while it is used
+ * \param msg -- UCS-2 message
+ * \param msg_len -- length of message in UCS-2 characters
+ * \return number of parts pdu_iter_next() will produce, -1 on error
+ *
+ * GSM7 is preferred over UCS-2. National language tables of 3GPP TS 23.038
+ * are used when they give less parts or septets than the default alphabet,
+ * they are announced in UDH of every part.
+ */
+EXPORT_DEF int pdu_iter_init(pdu_iter_t *iter, const char *sca, const char *dst, const uint16_t *msg, size_t msg_len, unsigned valid_minutes, int srr, uint8_t csmsref)
+{
+	int septets[GSM7_NATIONAL_TABLES][GSM7_NATIONAL_TABLES];
+	unsigned best_parts = 0, best_septets = 0, best_headers = 0;
+	unsigned ls, ss, cnt;
+
+	iter->sca = sca;
+	iter->dst = dst;
+	iter->msg = msg;
+	iter->msg_len = msg_len;
+	iter->off = 0;
+	iter->valid_minutes = valid_minutes;
+	iter->srr = srr;
+	pdu_udh_init(&iter->udh);
+	iter->udh.ref = csmsref;
+
+	if (gsm7_tables_septets(msg, msg_len, septets) > 0) {
+		unsigned caps[2], fill[2] = { 0, 0 }, parts[2] = { 0, 0 }, k;
+		size_t i;
+
+		/* fewest parts, then fewest septets, then fewest headers */
+		for (ls = 0; ls < GSM7_NATIONAL_TABLES; ++ls) {
+			for (ss = 0; ss < GSM7_NATIONAL_TABLES; ++ss) {
+				unsigned p, h = !!ls + !!ss;
+				if (septets[ls][ss] < 0) {
+					continue;
+				}
+				p = pdu_gsm7_parts(septets[ls][ss], ls, ss);
+				if (!best_parts || p < best_parts
+					|| (p == best_parts && ((unsigned) septets[ls][ss] < best_septets
+						|| ((unsigned) septets[ls][ss] == best_septets && h < best_headers)))) {
+					best_parts = p;
+					best_septets = septets[ls][ss];
+					best_headers = h;
+					iter->udh.ls = ls;
+					iter->udh.ss = ss;
 				}
-				septets += req;
 			}
-			++cnt;
-			off += n;
 		}
-		if (cnt > 255) {
-			chan_quectel_err = E_2BIG;
-			return -1;
-		}
-		off = 0;
-		while (off < msg_len) {
-			unsigned septets = 0, n;
-			for (n = 0; off + n < msg_len; ++n) {
-				unsigned req = msg_gsm7[off + n] > 255 ? 2 : 1;
-				if (septets + req >= split) {
-					break;
+
+		/* escaped characters are not split, so count the parts exactly */
+		caps[0] = pdu_gsm7_capacity(0, iter->udh.ls, iter->udh.ss);
+		caps[1] = pdu_gsm7_capacity(1, iter->udh.ls, iter->udh.ss);
+		for (i = 0; i < msg_len; ++i) {
+			uint16_t c;
+			unsigned req = gsm7_encode_ext(msg + i, 1, &c, iter->udh.ls, iter->udh.ss);
+			for (k = 0; k < ITEMS_OF(caps); ++k) {
+				if (fill[k] + req >= caps[k]) {
+					fill[k] = 0;
 				}
-				septets += req;
-			}
-			pdu_udh_t udh;
-			udh.ref = csmsref;
-			udh.order = i + 1;
-			udh.parts = cnt;
-			ssize_t curlen = pdu_build(pdus[i].buffer, PDU_LENGTH, &pdus[i].tpdu_length, sca, dst, PDU_DCS_ALPHABET_7BIT, msg_gsm7 + off, n, septets, valid_minutes, srr, &udh);
-			if (curlen < 0) {
-				/* pdu_build sets chan_quectel_err */
-				return -1;
+				if (fill[k] == 0) {
+					++parts[k];
+				}
+				fill[k] += req;
 			}
-			pdus[i].length = curlen;
-			off += n;
-			++i;
 		}
+
+		iter->dcs = PDU_DCS_ALPHABET_7BIT;
+		/* same boundary as pdu_gsm7_parts(), more parts always get the concatenated layout */
+		k = best_parts > 1;
+		iter->split = caps[k];
+		cnt = parts[k];
 	} else {
-		if (msg_len > SMS_UCS2_MAX_LEN) {
-			split = CSMS_UCS2_MAX_LEN;
-		} else {
-			split = SMS_UCS2_MAX_LEN;
-		}
-		cnt = (msg_len + split - 1) / split;
-		if (cnt > 255) {
-			chan_quectel_err = E_2BIG;
-			return -1;
+		iter->dcs = PDU_DCS_ALPHABET_UCS2;
+		iter->split = SMS_UD_MAX_LEN / 2;
+		if (msg_len > iter->split) {
+			iter->split = (SMS_UD_MAX_LEN - pdu_udh_length(1, 0, 0)) / 2;
 		}
-		while (off < msg_len) {
-			unsigned r = msg_len - off;
-			unsigned n = r < split ? r : split;
-			pdu_udh_t udh;
-			udh.ref = csmsref;
-			udh.order = i + 1;
-			udh.parts = cnt;
-			ssize_t curlen = pdu_build(pdus[i].buffer, PDU_LENGTH, &pdus[i].tpdu_length, sca, dst, PDU_DCS_ALPHABET_UCS2, msg + off, n, n * 2, valid_minutes, srr, &udh);
-			if (curlen < 0) {
-				/* pdu_build sets chan_quectel_err */
-				return -1;
+		cnt = (msg_len + iter->split - 1) / iter->split;
+	}
+
+	if (cnt > 255) {
+		chan_quectel_err = E_2BIG;
+		return -1;
+	}
+	iter->udh.parts = cnt;
+	return cnt;
+}
+
+/*!
+ * \brief Build next PDU of a message
+ * \param iter -- iterator initialized by pdu_iter_init()
+ * \param pdu -- buffer for the PDU
+ * \return 1 if PDU is built, 0 if message is complete, -1 on error
+ */
+EXPORT_DEF int pdu_iter_next(pdu_iter_t *iter, pdu_part_t *pdu)
+{
+	uint16_t gsm7[SMS_GSM7_MAX_LEN];
+	const uint16_t *part;
+	unsigned septets = 0, n;
+	ssize_t len;
+
+	if (iter->off >= iter->msg_len) {
+		return 0;
+	}
+
+	if (iter->dcs == PDU_DCS_ALPHABET_7BIT) {
+		for (n = 0; iter->off + n < iter->msg_len; ++n) {
+			/* characters are already checked by pdu_iter_init() */
+			unsigned req = gsm7_encode_ext(iter->msg + iter->off + n, 1, &gsm7[n], iter->udh.ls, iter->udh.ss);
+			if (septets + req >= iter->split) {
+				break;
 			}
-			pdus[i].length = curlen;
-			off += n;
-			++i;
+			septets += req;
 		}
+		part = gsm7;
+	} else {
+		size_t r = iter->msg_len - iter->off;
+		n = r < iter->split ? r : iter->split;
+		septets = n * 2;
+		part = iter->msg + iter->off;
 	}
 
-	return i;
+	iter->udh.order++;
+	len = pdu_build(pdu->buffer, PDU_LENGTH, &pdu->tpdu_length, iter->sca, iter->dst, iter->dcs, part, n, septets, iter->valid_minutes, iter->srr, &iter->udh);
+	if (len < 0) {
+		/* pdu_build sets chan_quectel_err */
+		return -1;
+	}
+	pdu->length = len;
+	iter->off += n;
+	return 1;
+}
+
+/*!
+ * \brief Build all PDUs of a message
+ * \param pdus -- array for up to 255 parts
+ * \return number of parts, -1 on error
+ */
+EXPORT_DEF int pdu_build_mult(pdu_part_t *pdus, const char *sca, const char *dst, const uint16_t* msg, size_t msg_len, unsigned valid_minutes, int srr, uint8_t csmsref)
+{
+	pdu_iter_t iter;
+	int i = 0, res;
+
+	if (pdu_iter_init(&iter, sca, dst, msg, msg_len, valid_minutes, srr, csmsref) < 0) {
+		return -1;
+	}
+	while ((res = pdu_iter_next(&iter, &pdus[i])) > 0) {
+		++i;
+	}
+
+	return res < 0 ? -1 : i;
 }
 
 
@@ -552,9 +649,9 @@ EXPORT_DEF ssize_t pdu_build(uint8_t *buffer, size_t length, size_t *tpdulen, co
 	int sca_toa = NUMBER_TYPE_INTERNATIONAL;
 	int dst_toa;
 	int pdutype = PDUTYPE_MTI_SMS_SUBMIT | PDUTYPE_RD_ACCEPT | PDUTYPE_VPF_RELATIVE | PDUTYPE_SRR_NOT_REQUESTED | PDUTYPE_UDHI_NO_HEADER | PDUTYPE_RP_IS_NOT_SET;
-	int use_udh = udh->parts > 1;
+	unsigned udh_len = pdu_udh_length(udh->parts > 1, udh->ls, udh->ss);
 	int res;
-	if (use_udh) pdutype |= PDUTYPE_UDHI_HAS_HEADER;
+	if (udh_len) pdutype |= PDUTYPE_UDHI_HAS_HEADER;
 
 	unsigned dst_len;
 	unsigned sca_len;
@@ -620,18 +717,31 @@ EXPORT_DEF ssize_t pdu_build(uint8_t *buffer, size_t length, size_t *tpdulen, co
 	buffer[len++] = PDU_PID_SMS;
 	buffer[len++] = dcs;
 	buffer[len++] = pdu_relative_validity(valid_minutes);
-	buffer[len++] = msg_len + (!use_udh ? 0 : dcs == PDU_DCS_ALPHABET_UCS2 ? 6 : 7);
+	buffer[len++] = msg_len + (dcs == PDU_DCS_ALPHABET_UCS2 ? udh_len : DIV7UP(udh_len * 8));
 
 	/* encode UDH */
 	int msg_padding = 0;
-	if (use_udh) {
-		buffer[len++] = 5;
-		buffer[len++] = 0;
-		buffer[len++] = 3;
-		buffer[len++] = udh->ref;
-		buffer[len++] = udh->parts;
-		buffer[len++] = udh->order;
-		msg_padding = 1;
+	if (udh_len) {
+		buffer[len++] = udh_len - 1;
+		if (udh->parts > 1) {
+			buffer[len++] = 0x00; /* Concatenated */
+			buffer[len++] = 3;
+			buffer[len++] = udh->ref;
+			buffer[len++] = udh->parts;
+			buffer[len++] = udh->order;
+		}
+		if (udh->ss) {
+			buffer[len++] = 0x24; /* National Language Single Shift */
+			buffer[len++] = 1;
+			buffer[len++] = udh->ss;
+		}
+		if (udh->ls) {
+			buffer[len++] = 0x25; /* National Language Locking Shift */
+			buffer[len++] = 1;
+			buffer[len++] = udh->ls;
+		}
+		/* user data starts at septet boundary */
+		msg_padding = DIV7UP(udh_len * 8) * 7 - udh_len * 8;
 	}
 
 	/* TP-User-Data */
@@ -910,13 +1020,15 @@ EXPORT_DEF int tpdu_parse_deliver(uint8_t *pdu, size_t pdu_length, int tpdu_type
 						return -1;
 					}
 					udh->ss = pdu[i++];
+					udhl -= 1;
 					break;
-				case 0x25: /* National Language Single Shift */
+				case 0x25: /* National Language Locking Shift */
 					if (iei_len != 1) {
 						chan_quectel_err = E_UNKNOWN;
 						return -1;
 					}
 					udh->ls = pdu[i++];
+					udhl -= 1;
 					break;
 				default:
 					/* skip rest of IEI */
@@ -39,7 +39,24 @@ typedef struct pdu_part
 	size_t tpdu_length, length;
 } pdu_part_t;
 
+/* segmentation state of a message, see pdu_iter_init() */
+typedef struct pdu_iter
+{
+	const char	*sca;
+	const char	*dst;
+	const uint16_t	*msg;
+	size_t		msg_len;
+	size_t		off;			/*!< first character of next part */
+	unsigned	valid_minutes;
+	int		srr;
+	int		dcs;
+	unsigned	split;			/*!< septets or characters per part */
+	pdu_udh_t	udh;
+} pdu_iter_t;
+
 EXPORT_DECL void pdu_udh_init(pdu_udh_t *udh);
+EXPORT_DECL int pdu_iter_init(pdu_iter_t *iter, const char* sca, const char* dst, const uint16_t* msg, size_t msg_len, unsigned valid_minutes, int srr, uint8_t csmsref);
+EXPORT_DECL int pdu_iter_next(pdu_iter_t *iter, pdu_part_t *pdu);
 EXPORT_DECL int pdu_build_mult(pdu_part_t *pdus, const char* sca, const char* dst, const uint16_t* msg, size_t msg_len, unsigned valid_minutes, int srr, uint8_t csmsref);
 EXPORT_DECL ssize_t pdu_build(uint8_t* buffer, size_t length, size_t *tpdulen, const char* sca, const char* dst, int dcs, const uint16_t* msg, unsigned msg_len, unsigned msg_bytes, unsigned valid_minutes, int srr, const pdu_udh_t *udh);
 EXPORT_DECL int pdu_parse_sca(uint8_t *pdu, size_t pdu_length, char *sca, size_t sca_len);
@@ -10,16 +10,103 @@
 
 #include "memmem.h"
 #include <string.h>			/* memchr() */
+#include <unistd.h>			/* sysconf() ftruncate() close() */
+#include <sys/mman.h>			/* mmap() munmap() */
+#include <sys/syscall.h>		/* __NR_memfd_create */
 
 #include "ringbuffer.h"
 
+#/* anonymous file for the mirror, -1 if the kernel has no memfd_create() */
+static int rb_memfd (size_t size)
+{
+#ifdef __NR_memfd_create
+	int fd = syscall (__NR_memfd_create, "ringbuffer", 1 /* MFD_CLOEXEC */);
+	if (fd >= 0 && ftruncate (fd, size) != 0)
+	{
+		close (fd);
+		fd = -1;
+	}
+	return fd;
+#else
+	(void) size;
+	return -1;
+#endif
+}
+
+/*!
+ * \brief Allocate a buffer mapped twice back to back
+ * \param size -- minimal size, rounded up to page size
+ * \return 0 on success, -1 if mapping failed and rb is unchanged
+ *
+ * Bytes at buffer + size + n are the same as at buffer + n, so any region of
+ * up to size bytes starting in the buffer can be accessed as one block.
+ */
+EXPORT_DEF int rb_init_mirror (struct ringbuffer* rb, size_t size)
+{
+	long page = sysconf (_SC_PAGESIZE);
+	char* base;
+	int fd;
+
+	if (page <= 0)
+	{
+		return -1;
+	}
+	size = (size + page - 1) / page * page;
+
+	fd = rb_memfd (size);
+	if (fd < 0)
+	{
+		return -1;
+	}
+
+	/* reserve address space for both copies, then map the file over it */
+	base = mmap (NULL, size * 2, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (base == MAP_FAILED)
+	{
+		close (fd);
+		return -1;
+	}
+	if (mmap (base, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED
+		|| mmap (base + size, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED)
+	{
+		munmap (base, size * 2);
+		close (fd);
+		return -1;
+	}
+	close (fd);
+
+	rb_init (rb, base, size);
+	rb->mirrored = 1;
+	return 0;
+}
+
+EXPORT_DEF void rb_fini (struct ringbuffer* rb)
+{
+	if (rb->mirrored)
+	{
+		munmap (rb->buffer, rb->size * 2);
+		rb->buffer = NULL;
+		rb->size = 0;
+		rb->mirrored = 0;
+	}
+	rb->used = rb->read = rb->write = 0;
+	rb->scanned = 0;
+	rb->scan_mem = NULL;
+}
+
+/* region of len bytes at offset off crosses end of buffer and has to be split */
+static inline int rb_wraps (const struct ringbuffer* rb, size_t off, size_t len)
+{
+	return !rb->mirrored && off + len > rb->size;
+}
+
 EXPORT_DEF int rb_memcmp (const struct ringbuffer* rb, const char* mem, size_t len)
 {
 	size_t tmp;
 
 	if (rb->used > 0 && len > 0 && rb->used >= len)
 	{
-		if ((rb->read + len) > rb->size)
+		if (rb_wraps (rb, rb->read, len))
 		{
 			tmp = rb->size - rb->read;
 			if (memcmp (rb->buffer + rb->read, mem, tmp) == 0)
@@ -52,7 +139,7 @@ EXPORT_DEF int rb_read_all_iov (const struct ringbuffer* rb, struct iovec iov[2]
 {
 	if (rb->used > 0)
 	{
-		if ((rb->read + rb->used) > rb->size)
+		if (rb_wraps (rb, rb->read, rb->used))
 		{
 			iov[0].iov_base = rb->buffer + rb->read;
 			iov[0].iov_len  = rb->size - rb->read;
@@ -81,7 +168,7 @@ EXPORT_DEF int rb_read_n_iov (const struct ringbuffer* rb, struct iovec iov[2],
 
 	if (len > 0)
 	{
-		if ((rb->read + len) > rb->size)
+		if (rb_wraps (rb, rb->read, len))
 		{
 			iov[0].iov_base = rb->buffer + rb->read;
 			iov[0].iov_len  = rb->size - rb->read;
@@ -107,7 +194,7 @@ EXPORT_DEF int rb_read_until_char_iov (const struct ringbuffer* rb, struct iovec
 
 	if (rb->used > 0)
 	{
-		if ((rb->read + rb->used) > rb->size)
+		if (rb_wraps (rb, rb->read, rb->used))
 		{
 			iov[0].iov_base = rb->buffer + rb->read;
 			iov[0].iov_len  = rb->size - rb->read;
@@ -141,92 +228,129 @@ EXPORT_DEF int rb_read_until_char_iov (const struct ringbuffer* rb, struct iovec
 	return 0;
 }
 
-EXPORT_DEF int rb_read_until_mem_iov (const struct ringbuffer* rb, struct iovec iov[2], const void* mem, size_t len)
+/* compare len bytes at offset off after read position with mem */
+static int rb_memcmp_at (const struct ringbuffer* rb, size_t off, const char* mem, size_t len)
 {
-	size_t	i;
-	void*	p;
+	size_t pos = rb->read + off;
+	size_t tail;
 
-	if (len == 1)
+	if (!rb->mirrored && pos >= rb->size)
 	{
-		return rb_read_until_char_iov (rb, iov, *((char*) mem));
+		pos -= rb->size;
 	}
 
-	if (rb->used > 0 && len > 0 && rb->used >= len)
+	if (rb_wraps (rb, pos, len))
 	{
-		if ((rb->read + rb->used) > rb->size)
+		tail = rb->size - pos;
+		return memcmp ((char*) rb->buffer + pos, mem, tail) || memcmp (rb->buffer, mem + tail, len - tail);
+	}
+
+	return memcmp ((char*) rb->buffer + pos, mem, len);
+}
+
+/*
+ * search mem starting at offset *off after read position, rb->used must be
+ * at least len; on match return 1 and set *off to its offset, otherwise return
+ * 0 and set *off to first offset not searched yet
+ *
+ * candidates are located by memchr() for the first byte of mem, libc
+ * implementations of it scan a vector register at a time
+ */
+static int rb_find_mem (const struct ringbuffer* rb, const char* mem, size_t len, size_t* off)
+{
+	size_t last = rb->used - len + 1;
+	size_t split = rb_wraps (rb, rb->read, rb->used) ? rb->size - rb->read : last;
+	size_t from = *off;
+	const char* start;
+	const char* p;
+	size_t n;
+
+	while (from < last)
+	{
+		if (from < split)
 		{
-			iov[0].iov_base = rb->buffer + rb->read;
-			iov[0].iov_len  = rb->size - rb->read;
-			if (iov[0].iov_len >= len)
-			{
-				if ((p = memmem (iov[0].iov_base, iov[0].iov_len, mem, len)) != NULL)
-				{
-					iov[0].iov_len = p - iov[0].iov_base;
-					iov[1].iov_len = 0;
-					return 1;
-				}
+			start = (char*) rb->buffer + rb->read + from;
+			n = (split < last ? split : last) - from;
+		}
+		else
+		{
+			start = (char*) rb->buffer + from - split;
+			n = last - from;
+		}
 
-				i = 1;
-				iov[1].iov_base = iov[0].iov_base + iov[0].iov_len - len + 1;
-			}
-			else
-			{
-				i = len - iov[0].iov_len;
-				iov[1].iov_base = iov[0].iov_base;
-			}
+		p = memchr (start, mem[0], n);
+		if (p == NULL)
+		{
+			from += n;
+			continue;
+		}
 
+		from += p - start;
+		if (rb_memcmp_at (rb, from, mem, len) == 0)
+		{
+			*off = from;
+			return 1;
+		}
+		from++;
+	}
 
-			while (i < len)
-			{
-				if (memcmp (iov[1].iov_base, mem, len - i) == 0 && memcmp (rb->buffer, mem + i, i) == 0)
-				{
-					iov[0].iov_len = iov[1].iov_base - iov[0].iov_base;
-					iov[1].iov_len = 0;
-					return 1;
-				}
+	*off = from;
+	return 0;
+}
 
-				if (rb->used == iov[0].iov_len + i)
-				{
-					return 0;
-				}
+/* fill iov with off bytes before found terminator */
+static int rb_until_iov (const struct ringbuffer* rb, struct iovec iov[2], size_t off)
+{
+	if (off == 0)
+	{
+		iov[0].iov_base = rb->buffer + rb->read;
+		iov[0].iov_len  = 0;
+		iov[1].iov_len  = 0;
+		return 1;
+	}
 
-				iov[1].iov_base++;
-				i++;
-			}
+	return rb_read_n_iov (rb, iov, off);
+}
 
-			if (rb->used >= iov[0].iov_len + len)
-			{
-				if ((p = memmem (rb->buffer, rb->used - iov[0].iov_len, mem, len)) != NULL)
-				{
-					if (p == rb->buffer)
-					{
-						iov[1].iov_len = 0;
-						return 1;
-					}
-
-					iov[1].iov_base = rb->buffer;
-					iov[1].iov_len = p - rb->buffer;
-					return 2;
-				}
-			}
-		}
-		else
-		{
-			iov[0].iov_base = rb->buffer + rb->read;
-			iov[0].iov_len  = rb->used;
-			if ((p = memmem (iov[0].iov_base, iov[0].iov_len, mem, len)) != NULL)
-			{
-				iov[0].iov_len = p - iov[0].iov_base;
-				iov[1].iov_len = 0;
+EXPORT_DEF int rb_read_until_mem_iov (const struct ringbuffer* rb, struct iovec iov[2], const void* mem, size_t len)
+{
+	size_t off = 0;
 
-				return 1;
-			}
-		}
+	if (len > 0 && rb->used > 0 && rb->used >= len && rb_find_mem (rb, mem, len, &off))
+	{
+		return rb_until_iov (rb, iov, off);
 	}
 
 	return 0;
 }
 
+/*
+ * incomplete lines are not searched again from their start after each
+ * readv(), the state is dropped by rb_read_upd()
+ */
+EXPORT_DEF int rb_scan_until_mem_iov (struct ringbuffer* rb, struct iovec iov[2], const void* mem, size_t len)
+{
+	size_t off = 0;
+	int found;
+
+	if (len == 0 || rb->used == 0 || rb->used < len)
+	{
+		return 0;
+	}
+
+	if (rb->scan_mem == mem && rb->scan_len == len)
+	{
+		off = rb->scanned;
+	}
+
+	found = rb_find_mem (rb, mem, len, &off);
+	rb->scanned  = off;
+	rb->scan_mem = mem;
+	rb->scan_len = len;
+
+	return found ? rb_until_iov (rb, iov, off) : 0;
+}
+
 EXPORT_DEF size_t rb_read_upd (struct ringbuffer* rb, size_t len)
 {
 	size_t s;
@@ -239,6 +363,8 @@ EXPORT_DEF size_t rb_read_upd (struct ringbuffer* rb, size_t len)
 	if (len > 0)
 	{
 		rb->used -= len;
+		rb->scanned = 0;
+		rb->scan_mem = NULL;
 
 		if (rb->used == 0)
 		{
@@ -317,7 +443,7 @@ EXPORT_DEF int rb_write_iov (const struct ringbuffer* rb, struct iovec iov[2])
 	free = rb_free (rb);
 	if (free > 0)
 	{
-		if ((rb->write + free) > rb->size)
+		if (rb_wraps (rb, rb->write, free))
 		{
 			iov[0].iov_base = rb->buffer + rb->write;
 			iov[0].iov_len  = rb->size - rb->write;
@@ -383,7 +509,7 @@ EXPORT_DEF size_t rb_write_core (struct ringbuffer* rb, const char* buf, size_t
 	{
 		s = rb->write + len;
 
-		if (s > rb->size)
+		if (rb_wraps (rb, rb->write, len))
 		{
 			(*method) (rb->buffer + rb->write, buf, rb->size - rb->write);
 			(*method) (rb->buffer, buf + rb->size - rb->write, s - rb->size);
@@ -392,9 +518,9 @@ EXPORT_DEF size_t rb_write_core (struct ringbuffer* rb, const char* buf, size_t
 		else
 		{
 			(*method) (rb->buffer + rb->write, buf, len);
-			if (s == rb->size)
+			if (s >= rb->size)
 			{
-				rb->write = 0;
+				rb->write = s - rb->size;
 			}
 			else
 			{
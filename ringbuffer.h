@@ -22,6 +22,10 @@ struct ringbuffer
 	size_t	used;			/*!< number of bytes used */
 	size_t	read;			/*!< read position */
 	size_t	write;			/*!< write position */
+	int	mirrored;		/*!< buffer is mapped twice back to back by rb_init_mirror() */
+	size_t	scanned;		/*!< bytes after read position searched by rb_scan_until_mem_iov() without match */
+	const void* scan_mem;		/*!< terminator of that search */
+	size_t	scan_len;		/*!< and its length */
 };
 
 
@@ -32,6 +36,26 @@ INLINE_DECL void rb_init (struct ringbuffer* rb, void* buf, size_t size)
 	rb->used   = 0;
 	rb->read   = 0;
 	rb->write  = 0;
+	rb->mirrored = 0;
+	rb->scanned = 0;
+	rb->scan_mem = NULL;
+	rb->scan_len = 0;
+}
+
+/*!< allocate buffer of at least size bytes mapped twice back to back, return 0 on success */
+EXPORT_DECL int rb_init_mirror (struct ringbuffer* rb, size_t size);
+
+/*!< release buffer allocated by rb_init_mirror() */
+EXPORT_DECL void rb_fini (struct ringbuffer* rb);
+
+/*!< start of first len bytes of read data as one block, NULL if they wrap and buffer is not mirrored */
+INLINE_DECL char* rb_read_contiguous (const struct ringbuffer* rb, size_t len)
+{
+	if (rb->mirrored || rb->read + len <= rb->size)
+	{
+		return (char*) rb->buffer + rb->read;
+	}
+	return NULL;
 }
 
 INLINE_DECL size_t rb_used (const struct ringbuffer* rb)
@@ -55,6 +79,9 @@ EXPORT_DECL int rb_read_n_iov (const struct ringbuffer* rb, struct iovec* iov, s
 EXPORT_DECL int rb_read_until_char_iov (const struct ringbuffer*, struct iovec iov[2], char);
 EXPORT_DECL int rb_read_until_mem_iov (const struct ringbuffer*, struct iovec iov[2], const void*, size_t);
 
+/*!< same as rb_read_until_mem_iov() but continue search where previous call for the same terminator stopped */
+EXPORT_DECL int rb_scan_until_mem_iov (struct ringbuffer* rb, struct iovec iov[2], const void* mem, size_t len);
+
 /*!< advice read position to len bytes */
 EXPORT_DECL size_t rb_read_upd (struct ringbuffer* rb, size_t len);
 
@@ -68,6 +68,31 @@ DEFINE_SQL_STATEMENT(cnt_outgoingpart_stmt, "SELECT m.cnt, (SELECT COUNT(p.rowid
 DEFINE_SQL_STATEMENT(cnt_all_outgoingpart_stmt, "SELECT m.cnt, (SELECT COUNT(p.rowid) FROM outgoing_part p WHERE p.msg = m.rowid) FROM outgoing_msg m WHERE m.rowid = ?")
 DEFINE_SQL_STATEMENT(get_payload_stmt, "SELECT payload, dst FROM outgoing_msg WHERE rowid = ?")
 DEFINE_SQL_STATEMENT(get_all_status_stmt, "SELECT status FROM outgoing_part WHERE msg = ? ORDER BY rowid")
+DEFINE_SQL_STATEMENT(create_outgoingpdu_stmt, "CREATE TABLE IF NOT EXISTS outgoing_pdu (msg INTEGER, part INTEGER, grp INTEGER, pdu BLOB, tpdulen INTEGER, state INTEGER, tries INTEGER DEFAULT 0, next_try TIMESTAMP DEFAULT CURRENT_TIMESTAMP, PRIMARY KEY(msg, part))") // parts not confirmed by +CMGS yet
+DEFINE_SQL_STATEMENT(put_outgoingpdu_stmt, "INSERT INTO outgoing_pdu (msg, part, grp, pdu, tpdulen, state) VALUES (?, ?, ?, ?, ?, 0)")
+DEFINE_SQL_STATEMENT(del_outgoingpdu_stmt, "DELETE FROM outgoing_pdu WHERE msg = ?")
+DEFINE_SQL_STATEMENT(set_pdu_state_stmt, "UPDATE outgoing_pdu SET state = ? WHERE msg = ? AND state = ? AND part >= ?")
+DEFINE_SQL_STATEMENT(ack_pdu_stmt, "DELETE FROM outgoing_pdu WHERE rowid = (SELECT rowid FROM outgoing_pdu WHERE msg = ? AND state = 1 ORDER BY part LIMIT 1)") // parts of one message are sent in order
+DEFINE_SQL_STATEMENT(get_sending_pdu_stmt, "SELECT rowid, tries FROM outgoing_pdu WHERE msg = ? AND state = 1 ORDER BY part LIMIT 1")
+DEFINE_SQL_STATEMENT(retry_pdu_stmt, "UPDATE outgoing_pdu SET state = 2, tries = ?, next_try = datetime(julianday(CURRENT_TIMESTAMP) + ? / 86400.0) WHERE rowid = ?")
+DEFINE_SQL_STATEMENT(reset_dev_pdus_stmt, "UPDATE outgoing_pdu SET state = 2 WHERE state != 2 AND msg IN (SELECT rowid FROM outgoing_msg WHERE dev = ?)")
+DEFINE_SQL_STATEMENT(reset_all_pdus_stmt, "UPDATE outgoing_pdu SET state = 2 WHERE state != 2")
+DEFINE_SQL_STATEMENT(cnt_dev_pdus_stmt, "SELECT m.dev, COUNT(p.rowid) FROM outgoing_pdu p JOIN outgoing_msg m ON m.rowid = p.msg GROUP BY m.dev")
+DEFINE_SQL_STATEMENT(pick_resume_stmt, "SELECT p.msg, (SELECT COUNT(q.rowid) FROM outgoing_pdu q WHERE q.msg = p.msg AND q.state = 2) FROM outgoing_pdu p JOIN outgoing_msg m ON m.rowid = p.msg WHERE p.state = 2 AND ("
+	"(m.dev = ?1 AND p.next_try <= CURRENT_TIMESTAMP) OR "
+	"(m.dev != ?1 AND p.grp = ?2 AND p.next_try <= datetime(julianday(CURRENT_TIMESTAMP) - ?3 / 86400.0) "
+	"AND NOT EXISTS (SELECT 1 FROM outgoing_pdu q WHERE q.msg = p.msg AND q.state != 2) "
+	"AND (SELECT COUNT(q.rowid) FROM outgoing_pdu q WHERE q.msg = p.msg) = m.cnt)) "
+	"ORDER BY p.next_try LIMIT 1") // a message can move to other device of the group only when no part of it is sent
+DEFINE_SQL_STATEMENT(set_outgoingmsg_dev_stmt, "UPDATE outgoing_msg SET dev = ? WHERE rowid = ?")
+DEFINE_SQL_STATEMENT(get_resume_pdus_stmt, "SELECT pdu, tpdulen FROM outgoing_pdu WHERE msg = ? AND state = 2 ORDER BY part")
+DEFINE_SQL_STATEMENT(create_discovery_stmt, "CREATE TABLE IF NOT EXISTS discovery (usb VARCHAR(64), identity VARCHAR(256), imei VARCHAR(16), imsi VARCHAR(16), PRIMARY KEY(usb))") // IMEI/IMSI of modem port set, reused while sysfs identity is same
+DEFINE_SQL_STATEMENT(get_discovery_stmt, "SELECT imei, imsi FROM discovery WHERE usb = ? AND identity = ?")
+DEFINE_SQL_STATEMENT(put_discovery_stmt, "INSERT OR REPLACE INTO discovery (usb, identity, imei, imsi) VALUES (?, ?, ?, ?)")
+DEFINE_SQL_STATEMENT(clear_discovery_stmt, "DELETE FROM discovery")
+DEFINE_SQL_STATEMENT(forget_discovery_stmt, "DELETE FROM discovery WHERE imei = ? OR imsi = ?")
+DEFINE_SQL_STATEMENT(list_discovery_stmt, "SELECT usb FROM discovery")
+DEFINE_SQL_STATEMENT(del_discovery_stmt, "DELETE FROM discovery WHERE usb = ?")
 DEFINE_SQL_STATEMENT(get_expired_stmt, "SELECT rowid, payload, dst FROM outgoing_msg WHERE expiration < CURRENT_TIMESTAMP LIMIT 1") // only fetch one expired row to balance the load of each transaction
 
 static int init_stmt(sqlite3_stmt **stmt, const char *sql, size_t len)
@@ -131,6 +156,26 @@ static void clean_statements(void)
 	clean_stmt(&get_payload_stmt, get_payload_stmt_sql);
 	clean_stmt(&get_all_status_stmt, get_all_status_stmt_sql);
 	clean_stmt(&get_expired_stmt, get_expired_stmt_sql);
+	clean_stmt(&create_outgoingpdu_stmt, create_outgoingpdu_stmt_sql);
+	clean_stmt(&put_outgoingpdu_stmt, put_outgoingpdu_stmt_sql);
+	clean_stmt(&del_outgoingpdu_stmt, del_outgoingpdu_stmt_sql);
+	clean_stmt(&set_pdu_state_stmt, set_pdu_state_stmt_sql);
+	clean_stmt(&ack_pdu_stmt, ack_pdu_stmt_sql);
+	clean_stmt(&get_sending_pdu_stmt, get_sending_pdu_stmt_sql);
+	clean_stmt(&retry_pdu_stmt, retry_pdu_stmt_sql);
+	clean_stmt(&reset_dev_pdus_stmt, reset_dev_pdus_stmt_sql);
+	clean_stmt(&reset_all_pdus_stmt, reset_all_pdus_stmt_sql);
+	clean_stmt(&cnt_dev_pdus_stmt, cnt_dev_pdus_stmt_sql);
+	clean_stmt(&pick_resume_stmt, pick_resume_stmt_sql);
+	clean_stmt(&set_outgoingmsg_dev_stmt, set_outgoingmsg_dev_stmt_sql);
+	clean_stmt(&get_resume_pdus_stmt, get_resume_pdus_stmt_sql);
+	clean_stmt(&create_discovery_stmt, create_discovery_stmt_sql);
+	clean_stmt(&get_discovery_stmt, get_discovery_stmt_sql);
+	clean_stmt(&put_discovery_stmt, put_discovery_stmt_sql);
+	clean_stmt(&clear_discovery_stmt, clear_discovery_stmt_sql);
+	clean_stmt(&forget_discovery_stmt, forget_discovery_stmt_sql);
+	clean_stmt(&list_discovery_stmt, list_discovery_stmt_sql);
+	clean_stmt(&del_discovery_stmt, del_discovery_stmt_sql);
 }
 
 static int init_statements(void)
@@ -157,6 +202,24 @@ static int init_statements(void)
 	|| init_stmt(&get_payload_stmt, get_payload_stmt_sql, sizeof(get_payload_stmt_sql))
 	|| init_stmt(&get_all_status_stmt, get_all_status_stmt_sql, sizeof(get_all_status_stmt_sql))
 	|| init_stmt(&get_expired_stmt, get_expired_stmt_sql, sizeof(get_expired_stmt_sql))
+	|| init_stmt(&put_outgoingpdu_stmt, put_outgoingpdu_stmt_sql, sizeof(put_outgoingpdu_stmt_sql))
+	|| init_stmt(&del_outgoingpdu_stmt, del_outgoingpdu_stmt_sql, sizeof(del_outgoingpdu_stmt_sql))
+	|| init_stmt(&set_pdu_state_stmt, set_pdu_state_stmt_sql, sizeof(set_pdu_state_stmt_sql))
+	|| init_stmt(&ack_pdu_stmt, ack_pdu_stmt_sql, sizeof(ack_pdu_stmt_sql))
+	|| init_stmt(&get_sending_pdu_stmt, get_sending_pdu_stmt_sql, sizeof(get_sending_pdu_stmt_sql))
+	|| init_stmt(&retry_pdu_stmt, retry_pdu_stmt_sql, sizeof(retry_pdu_stmt_sql))
+	|| init_stmt(&reset_dev_pdus_stmt, reset_dev_pdus_stmt_sql, sizeof(reset_dev_pdus_stmt_sql))
+	|| init_stmt(&reset_all_pdus_stmt, reset_all_pdus_stmt_sql, sizeof(reset_all_pdus_stmt_sql))
+	|| init_stmt(&cnt_dev_pdus_stmt, cnt_dev_pdus_stmt_sql, sizeof(cnt_dev_pdus_stmt_sql))
+	|| init_stmt(&pick_resume_stmt, pick_resume_stmt_sql, sizeof(pick_resume_stmt_sql))
+	|| init_stmt(&set_outgoingmsg_dev_stmt, set_outgoingmsg_dev_stmt_sql, sizeof(set_outgoingmsg_dev_stmt_sql))
+	|| init_stmt(&get_resume_pdus_stmt, get_resume_pdus_stmt_sql, sizeof(get_resume_pdus_stmt_sql))
+	|| init_stmt(&get_discovery_stmt, get_discovery_stmt_sql, sizeof(get_discovery_stmt_sql))
+	|| init_stmt(&put_discovery_stmt, put_discovery_stmt_sql, sizeof(put_discovery_stmt_sql))
+	|| init_stmt(&clear_discovery_stmt, clear_discovery_stmt_sql, sizeof(clear_discovery_stmt_sql))
+	|| init_stmt(&forget_discovery_stmt, forget_discovery_stmt_sql, sizeof(forget_discovery_stmt_sql))
+	|| init_stmt(&list_discovery_stmt, list_discovery_stmt_sql, sizeof(list_discovery_stmt_sql))
+	|| init_stmt(&del_discovery_stmt, del_discovery_stmt_sql, sizeof(del_discovery_stmt_sql))
 	|| init_stmt(&pick_mms_message_stmt, pick_mms_message_stmt_sql, sizeof(pick_mms_message_stmt_sql))
 	|| init_stmt(&put_mms_message_stmt, put_mms_message_stmt_sql, sizeof(put_mms_message_stmt_sql))
 	|| init_stmt(&delete_mms_message_stmt, delete_mms_message_stmt_sql, sizeof(delete_mms_message_stmt_sql))
@@ -243,6 +306,28 @@ static int db_create_smsdb(void)
 	}
 	sqlite3_reset(create_outgoingmsg_index_stmt);
 	ast_mutex_unlock(&dblock);
+
+	if (!create_outgoingpdu_stmt) {
+		init_stmt(&create_outgoingpdu_stmt, create_outgoingpdu_stmt_sql, sizeof(create_outgoingpdu_stmt_sql));
+	}
+	ast_mutex_lock(&dblock);
+	if (sqlite3_step(create_outgoingpdu_stmt) != SQLITE_DONE) {
+		ast_log(LOG_WARNING, "Couldn't create smsdb outgoing table: %s\n", sqlite3_errmsg(smsdb));
+		res = -1;
+	}
+	sqlite3_reset(create_outgoingpdu_stmt);
+	ast_mutex_unlock(&dblock);
+
+	if (!create_discovery_stmt) {
+		init_stmt(&create_discovery_stmt, create_discovery_stmt_sql, sizeof(create_discovery_stmt_sql));
+	}
+	ast_mutex_lock(&dblock);
+	if (sqlite3_step(create_discovery_stmt) != SQLITE_DONE) {
+		ast_log(LOG_WARNING, "Couldn't create smsdb discovery table: %s\n", sqlite3_errmsg(smsdb));
+		res = -1;
+	}
+	sqlite3_reset(create_discovery_stmt);
+	ast_mutex_unlock(&dblock);
 	return res;
 }
 
@@ -278,6 +363,16 @@ static int db_init()
 		return -1;
 	}
 
+	/* parts spooled or sent by previous run are unconfirmed, send them again */
+	ast_mutex_lock(&dblock);
+	if (sqlite3_step(reset_all_pdus_stmt) != SQLITE_DONE) {
+		ast_log(LOG_WARNING, "Couldn't reset outgoing parts: %s\n", sqlite3_errmsg(smsdb));
+	} else if (sqlite3_changes(smsdb) > 0) {
+		ast_log(LOG_NOTICE, "%d unconfirmed outgoing SMS part(s) will be resent\n", sqlite3_changes(smsdb));
+	}
+	sqlite3_reset(reset_all_pdus_stmt);
+	ast_mutex_unlock(&dblock);
+
 	return 0;
 }
 
@@ -298,8 +393,16 @@ static int db_execute_sql(const char *sql, int (*callback)(void *, int, char **,
 	return res;
 }
 
+/* nesting depth of smsdb_batch_begin() / smsdb_batch_end() of the current thread,
+ * the per call transactions are merged into the outermost batch one */
+static __thread int smsdb_batch_active;
+
+/* inside a batch each call runs in a savepoint, so a failed one is undone without the rest */
 static int smsdb_begin_transaction(void)
 {
+	if (smsdb_batch_active) {
+		return db_execute_sql("SAVEPOINT smsdb_item", NULL, NULL);
+	}
 	ast_mutex_lock(&dblock);
 	int res = db_execute_sql("BEGIN TRANSACTION", NULL, NULL);
 	return res;
@@ -307,6 +410,9 @@ static int smsdb_begin_transaction(void)
 
 static int smsdb_commit_transaction(void)
 {
+	if (smsdb_batch_active) {
+		return db_execute_sql("RELEASE smsdb_item", NULL, NULL);
+	}
 	int res = db_execute_sql("COMMIT", NULL, NULL);
 	ast_mutex_unlock(&dblock);
 	return res;
@@ -314,11 +420,40 @@ static int smsdb_commit_transaction(void)
 
 static int smsdb_rollback_transaction(void)
 {
+	if (smsdb_batch_active) {
+		int res = db_execute_sql("ROLLBACK TO smsdb_item", NULL, NULL);
+		/* ROLLBACK TO keeps the savepoint open */
+		db_execute_sql("RELEASE smsdb_item", NULL, NULL);
+		return res;
+	}
 	int res = db_execute_sql("ROLLBACK", NULL, NULL);
 	ast_mutex_unlock(&dblock);
 	return res;
 }
 
+/*!
+ * \brief Start a batch, all following smsdb calls of this thread share one transaction
+ * \note batches may nest, only the outermost smsdb_batch_end() commits
+ * \note dblock is held until smsdb_batch_end(), do not take pvt locks in between
+ */
+EXPORT_DEF int smsdb_batch_begin()
+{
+	int res = smsdb_batch_active ? 0 : smsdb_begin_transaction();
+	smsdb_batch_active++;
+	return res;
+}
+
+/*!
+ * \brief Commit the transaction started by smsdb_batch_begin()
+ */
+EXPORT_DEF int smsdb_batch_end()
+{
+	if (--smsdb_batch_active) {
+		return 0;
+	}
+	return smsdb_commit_transaction();
+}
+
 /*!
  * \brief Adds a MMS message to incoming processing queue.
  * \param imsi -- Received IMSI
@@ -464,8 +599,6 @@ EXPORT_DEF int smsdb_get_refid(const char *id, const char *addr)
 {
 	int res = 0;
 
-	smsdb_begin_transaction();
-
 	char fullkey[MAX_DB_FIELD + 1];
 	int fullkey_len;
 
@@ -475,6 +608,8 @@ EXPORT_DEF int smsdb_get_refid(const char *id, const char *addr)
 		return -1;
 	}
 
+	smsdb_begin_transaction();
+
 	int use_insert = 0;
 	if (sqlite3_bind_text(get_outgoingref_stmt, 1, fullkey, fullkey_len, SQLITE_STATIC) != SQLITE_OK) {
 		ast_log(LOG_WARNING, "Couldn't bind key to stmt: %s\n", sqlite3_errmsg(smsdb));
@@ -562,7 +697,15 @@ static int smsdb_outgoing_clear_nolock(int uid)
 		res = -1;
 	}
 	sqlite3_reset(del_outgoingpart_stmt);
-	
+
+	if (sqlite3_bind_int(del_outgoingpdu_stmt, 1, uid) != SQLITE_OK) {
+		ast_log(LOG_WARNING, "Couldn't bind UID to stmt: %s\n", sqlite3_errmsg(smsdb));
+		res = -1;
+	} else if (sqlite3_step(del_outgoingpdu_stmt) != SQLITE_DONE) {
+		res = -1;
+	}
+	sqlite3_reset(del_outgoingpdu_stmt);
+
 	return res;
 }
 EXPORT_DEF ssize_t smsdb_outgoing_clear(int uid, char *dst, char *payload)
@@ -600,6 +743,14 @@ EXPORT_DEF ssize_t smsdb_outgoing_part_put(int uid, int refid, char *dst, char *
 
 	smsdb_begin_transaction();
 
+	// part is confirmed, it will not be resent
+	if (sqlite3_bind_int(ack_pdu_stmt, 1, uid) != SQLITE_OK) {
+		ast_log(LOG_WARNING, "Couldn't bind UID to stmt: %s\n", sqlite3_errmsg(smsdb));
+	} else if (sqlite3_step(ack_pdu_stmt) != SQLITE_DONE) {
+		ast_log(LOG_WARNING, "Couldn't confirm outgoing part: %s\n", sqlite3_errmsg(smsdb));
+	}
+	sqlite3_reset(ack_pdu_stmt);
+
 	if (sqlite3_bind_int(get_outgoingmsg_stmt, 1, uid) != SQLITE_OK) {
 		ast_log(LOG_WARNING, "Couldn't bind UID to stmt: %s\n", sqlite3_errmsg(smsdb));
 		res = -1;
@@ -613,7 +764,7 @@ EXPORT_DEF ssize_t smsdb_outgoing_part_put(int uid, int refid, char *dst, char *
 		fullkey_len = snprintf(fullkey, sizeof(fullkey), "%s/%s/%d", dev, dst, refid);
 		if (fullkey_len < 0) {
 			ast_log(LOG_ERROR, "Key length must be less than %zu bytes\n", sizeof(fullkey));
-			return -1;
+			res = -1;
 		}
 	}
 	sqlite3_reset(get_outgoingmsg_stmt);
@@ -802,6 +953,486 @@ EXPORT_DEF ssize_t smsdb_outgoing_purge_one(char *dst, char *payload)
 	return res;
 }
 
+/*!
+ * \brief Store PDU of an outgoing message part, until it is confirmed by +CMGS it can be resent
+ * \param uid -- message id returned by smsdb_outgoing_add()
+ * \param part -- part index
+ * \param grp -- group of the sending device, other devices of the group may take the message over
+ */
+EXPORT_DEF int smsdb_outgoing_pdu_add(int uid, int part, int grp, const pdu_part_t *pdu)
+{
+	int res = 0;
+
+	smsdb_begin_transaction();
+
+	if (sqlite3_bind_int(put_outgoingpdu_stmt, 1, uid) != SQLITE_OK) {
+		ast_log(LOG_WARNING, "Couldn't bind UID to stmt: %s\n", sqlite3_errmsg(smsdb));
+		res = -1;
+	} else if (sqlite3_bind_int(put_outgoingpdu_stmt, 2, part) != SQLITE_OK) {
+		ast_log(LOG_WARNING, "Couldn't bind part to stmt: %s\n", sqlite3_errmsg(smsdb));
+		res = -1;
+	} else if (sqlite3_bind_int(put_outgoingpdu_stmt, 3, grp) != SQLITE_OK) {
+		ast_log(LOG_WARNING, "Couldn't bind group to stmt: %s\n", sqlite3_errmsg(smsdb));
+		res = -1;
+	} else if (sqlite3_bind_blob(put_outgoingpdu_stmt, 4, pdu->buffer, pdu->length, SQLITE_STATIC) != SQLITE_OK) {
+		ast_log(LOG_WARNING, "Couldn't bind PDU to stmt: %s\n", sqlite3_errmsg(smsdb));
+		res = -1;
+	} else if (sqlite3_bind_int(put_outgoingpdu_stmt, 5, pdu->tpdu_length) != SQLITE_OK) {
+		ast_log(LOG_WARNING, "Couldn't bind TPDU length to stmt: %s\n", sqlite3_errmsg(smsdb));
+		res = -1;
+	} else if (sqlite3_step(put_outgoingpdu_stmt) != SQLITE_DONE) {
+		res = -1;
+	}
+	sqlite3_reset(put_outgoingpdu_stmt);
+
+	if (res < 0) {
+		smsdb_rollback_transaction();
+	} else {
+		smsdb_commit_transaction();
+	}
+
+	return res;
+}
+
+static int smsdb_outgoing_pdu_state(int uid, int first, int from, int to)
+{
+	int res = 0;
+
+	smsdb_begin_transaction();
+
+	if (sqlite3_bind_int(set_pdu_state_stmt, 1, to) != SQLITE_OK) {
+		ast_log(LOG_WARNING, "Couldn't bind state to stmt: %s\n", sqlite3_errmsg(smsdb));
+		res = -1;
+	} else if (sqlite3_bind_int(set_pdu_state_stmt, 2, uid) != SQLITE_OK) {
+		ast_log(LOG_WARNING, "Couldn't bind UID to stmt: %s\n", sqlite3_errmsg(smsdb));
+		res = -1;
+	} else if (sqlite3_bind_int(set_pdu_state_stmt, 3, from) != SQLITE_OK) {
+		ast_log(LOG_WARNING, "Couldn't bind state to stmt: %s\n", sqlite3_errmsg(smsdb));
+		res = -1;
+	} else if (sqlite3_bind_int(set_pdu_state_stmt, 4, first) != SQLITE_OK) {
+		ast_log(LOG_WARNING, "Couldn't bind part to stmt: %s\n", sqlite3_errmsg(smsdb));
+		res = -1;
+	} else if (sqlite3_step(set_pdu_state_stmt) != SQLITE_DONE) {
+		res = -1;
+	}
+	sqlite3_reset(set_pdu_state_stmt);
+
+	smsdb_commit_transaction();
+
+	return res;
+}
+
+/*!
+ * \brief Mark spooled parts of message as written to the device queue
+ */
+EXPORT_DEF int smsdb_outgoing_pdu_sending(int uid)
+{
+	return smsdb_outgoing_pdu_state(uid, 0, SMSDB_PDU_SPOOLED, SMSDB_PDU_SENDING);
+}
+
+/*!
+ * \brief Return spooled parts of message to smsdb, they will be picked by smsdb_outgoing_resume()
+ * \param first -- first part to return, the ones before it stay spooled
+ */
+EXPORT_DEF int smsdb_outgoing_pdu_unspool(int uid, int first)
+{
+	return smsdb_outgoing_pdu_state(uid, first, SMSDB_PDU_SPOOLED, SMSDB_PDU_WAITING);
+}
+
+/*!
+ * \brief Return all spooled and not confirmed parts of device to smsdb, used when device queue is lost
+ * \param id -- IMSI of device
+ */
+EXPORT_DEF int smsdb_outgoing_pdu_reset(const char *id)
+{
+	int res = 0;
+
+	smsdb_begin_transaction();
+
+	if (sqlite3_bind_text(reset_dev_pdus_stmt, 1, id, strlen(id), SQLITE_STATIC) != SQLITE_OK) {
+		ast_log(LOG_WARNING, "Couldn't bind dev to stmt: %s\n", sqlite3_errmsg(smsdb));
+		res = -1;
+	} else if (sqlite3_step(reset_dev_pdus_stmt) != SQLITE_DONE) {
+		res = -1;
+	} else {
+		res = sqlite3_changes(smsdb);
+	}
+	sqlite3_reset(reset_dev_pdus_stmt);
+
+	smsdb_commit_transaction();
+
+	return res;
+}
+
+/*!
+ * \brief Count parts not confirmed by +CMGS yet for each device
+ * \param list -- result, free with ast_free()
+ * \return number of devices in list, -1 on error
+ */
+EXPORT_DEF int smsdb_outgoing_backlog(struct smsdb_backlog **list)
+{
+	struct smsdb_backlog *tmp;
+	int res = 0, size = 0;
+	const char *dev;
+
+	*list = NULL;
+	smsdb_begin_transaction();
+
+	while (sqlite3_step(cnt_dev_pdus_stmt) == SQLITE_ROW) {
+		if (res == size) {
+			tmp = ast_realloc(*list, (size + 16) * sizeof(**list));
+			if (!tmp) {
+				res = -1;
+				break;
+			}
+			*list = tmp;
+			size += 16;
+		}
+		dev = (const char *) sqlite3_column_text(cnt_dev_pdus_stmt, 0);
+		ast_copy_string((*list)[res].dev, dev ? dev : "", sizeof((*list)[res].dev));
+		(*list)[res].parts = sqlite3_column_int(cnt_dev_pdus_stmt, 1);
+		++res;
+	}
+	sqlite3_reset(cnt_dev_pdus_stmt);
+
+	smsdb_commit_transaction();
+
+	if (res < 0) {
+		ast_free(*list);
+		*list = NULL;
+	}
+	return res;
+}
+
+/*!
+ * \brief Handle rejected part of message
+ * \param uid -- message id
+ * \param retries -- maximal number of resend attempts
+ * \param delay -- seconds before first resend, doubled on each next attempt
+ * \return 1 if resend is scheduled, 0 if attempts are exhausted, -1 on error
+ */
+EXPORT_DEF int smsdb_outgoing_pdu_failed(int uid, int retries, int delay)
+{
+	int res = 0, partid, tries;
+
+	smsdb_begin_transaction();
+
+	if (sqlite3_bind_int(get_sending_pdu_stmt, 1, uid) != SQLITE_OK) {
+		ast_log(LOG_WARNING, "Couldn't bind UID to stmt: %s\n", sqlite3_errmsg(smsdb));
+		res = -1;
+	} else if (sqlite3_step(get_sending_pdu_stmt) != SQLITE_ROW) {
+		res = -1;
+	} else {
+		partid = sqlite3_column_int(get_sending_pdu_stmt, 0);
+		tries = sqlite3_column_int(get_sending_pdu_stmt, 1);
+	}
+	sqlite3_reset(get_sending_pdu_stmt);
+
+	if (res >= 0 && tries < retries) {
+		delay <<= tries < 10 ? tries : 10;
+		if (sqlite3_bind_int(retry_pdu_stmt, 1, tries + 1) != SQLITE_OK) {
+			ast_log(LOG_WARNING, "Couldn't bind tries to stmt: %s\n", sqlite3_errmsg(smsdb));
+			res = -1;
+		} else if (sqlite3_bind_int(retry_pdu_stmt, 2, delay) != SQLITE_OK) {
+			ast_log(LOG_WARNING, "Couldn't bind delay to stmt: %s\n", sqlite3_errmsg(smsdb));
+			res = -1;
+		} else if (sqlite3_bind_int(retry_pdu_stmt, 3, partid) != SQLITE_OK) {
+			ast_log(LOG_WARNING, "Couldn't bind ID to stmt: %s\n", sqlite3_errmsg(smsdb));
+			res = -1;
+		} else if (sqlite3_step(retry_pdu_stmt) != SQLITE_DONE) {
+			res = -1;
+		} else {
+			res = 1;
+		}
+		sqlite3_reset(retry_pdu_stmt);
+	}
+
+	smsdb_commit_transaction();
+
+	return res;
+}
+
+/*!
+ * \brief Take a message waiting for (re)send
+ * \param id -- IMSI of device
+ * \param grp -- group of device
+ * \param takeover -- seconds after which waiting message of other device of the group is taken over
+ * \param uid -- message id
+ * \param parts -- number of not yet confirmed parts filled
+ * \return allocated array of parts, free with ast_free(), NULL if nothing is waiting
+ *
+ * Parts of the returned message are marked as spooled by the device.
+ */
+EXPORT_DEF pdu_part_t *smsdb_outgoing_resume(const char *id, int grp, int takeover, int *uid, unsigned *parts)
+{
+	int res = 0;
+	unsigned max = 0;
+	pdu_part_t *pdus = NULL;
+
+	*parts = 0;
+	smsdb_begin_transaction();
+
+	if (sqlite3_bind_text(pick_resume_stmt, 1, id, strlen(id), SQLITE_STATIC) != SQLITE_OK) {
+		ast_log(LOG_WARNING, "Couldn't bind dev to stmt: %s\n", sqlite3_errmsg(smsdb));
+		res = -1;
+	} else if (sqlite3_bind_int(pick_resume_stmt, 2, grp) != SQLITE_OK) {
+		ast_log(LOG_WARNING, "Couldn't bind group to stmt: %s\n", sqlite3_errmsg(smsdb));
+		res = -1;
+	} else if (sqlite3_bind_int(pick_resume_stmt, 3, takeover) != SQLITE_OK) {
+		ast_log(LOG_WARNING, "Couldn't bind takeover to stmt: %s\n", sqlite3_errmsg(smsdb));
+		res = -1;
+	} else if (sqlite3_step(pick_resume_stmt) != SQLITE_ROW) {
+		res = -1;
+	} else {
+		*uid = sqlite3_column_int(pick_resume_stmt, 0);
+		max = sqlite3_column_int(pick_resume_stmt, 1);
+	}
+	sqlite3_reset(pick_resume_stmt);
+
+	// owner must match for status reports
+	if (res >= 0) {
+		if (sqlite3_bind_text(set_outgoingmsg_dev_stmt, 1, id, strlen(id), SQLITE_STATIC) != SQLITE_OK) {
+			ast_log(LOG_WARNING, "Couldn't bind dev to stmt: %s\n", sqlite3_errmsg(smsdb));
+			res = -1;
+		} else if (sqlite3_bind_int(set_outgoingmsg_dev_stmt, 2, *uid) != SQLITE_OK) {
+			ast_log(LOG_WARNING, "Couldn't bind UID to stmt: %s\n", sqlite3_errmsg(smsdb));
+			res = -1;
+		} else if (sqlite3_step(set_outgoingmsg_dev_stmt) != SQLITE_DONE) {
+			res = -1;
+		}
+		sqlite3_reset(set_outgoingmsg_dev_stmt);
+	}
+
+	if (res >= 0) {
+		pdus = ast_malloc(max * sizeof(*pdus));
+		if (!pdus) {
+			res = -1;
+		}
+	}
+
+	if (res >= 0) {
+		if (sqlite3_bind_int(get_resume_pdus_stmt, 1, *uid) != SQLITE_OK) {
+			ast_log(LOG_WARNING, "Couldn't bind UID to stmt: %s\n", sqlite3_errmsg(smsdb));
+			res = -1;
+		} else while (*parts < max && sqlite3_step(get_resume_pdus_stmt) == SQLITE_ROW) {
+			pdu_part_t *pdu = &pdus[(*parts)++];
+			size_t len = sqlite3_column_bytes(get_resume_pdus_stmt, 0);
+			pdu->length = len > sizeof(pdu->buffer) ? sizeof(pdu->buffer) : len;
+			memcpy(pdu->buffer, sqlite3_column_blob(get_resume_pdus_stmt, 0), pdu->length);
+			pdu->tpdu_length = sqlite3_column_int(get_resume_pdus_stmt, 1);
+		}
+		sqlite3_reset(get_resume_pdus_stmt);
+	}
+
+	if (res >= 0) {
+		if (sqlite3_bind_int(set_pdu_state_stmt, 1, SMSDB_PDU_SPOOLED) != SQLITE_OK
+			|| sqlite3_bind_int(set_pdu_state_stmt, 2, *uid) != SQLITE_OK
+			|| sqlite3_bind_int(set_pdu_state_stmt, 3, SMSDB_PDU_WAITING) != SQLITE_OK
+			|| sqlite3_bind_int(set_pdu_state_stmt, 4, 0) != SQLITE_OK) {
+			ast_log(LOG_WARNING, "Couldn't bind state to stmt: %s\n", sqlite3_errmsg(smsdb));
+			res = -1;
+		} else if (sqlite3_step(set_pdu_state_stmt) != SQLITE_DONE) {
+			res = -1;
+		}
+		sqlite3_reset(set_pdu_state_stmt);
+	}
+
+	if (res < 0) {
+		smsdb_rollback_transaction();
+		ast_free(pdus);
+		*parts = 0;
+		return NULL;
+	}
+
+	smsdb_commit_transaction();
+
+	if (!*parts) {
+		ast_free(pdus);
+		return NULL;
+	}
+	return pdus;
+}
+
+/*!
+ * \brief Get IMEI and IMSI stored by smsdb_discovery_put()
+ * \param usb -- USB device path in sysfs
+ * \param identity -- ports and ids of device, must match stored ones
+ * \param imei -- result, empty if unknown
+ * \param imsi -- result, empty if unknown
+ * \retval 1 found
+ * \retval 0 not found or identity changed
+ */
+EXPORT_DEF int smsdb_discovery_get(const char *usb, const char *identity, char *imei, size_t imei_len, char *imsi, size_t imsi_len)
+{
+	int res = 0;
+	const char *tmp;
+
+	if (!get_discovery_stmt) {
+		return 0;
+	}
+
+	ast_mutex_lock(&dblock);
+	if (sqlite3_bind_text(get_discovery_stmt, 1, usb, -1, SQLITE_STATIC) != SQLITE_OK
+			|| sqlite3_bind_text(get_discovery_stmt, 2, identity, -1, SQLITE_STATIC) != SQLITE_OK) {
+		ast_log(LOG_WARNING, "Couldn't bind key to stmt: %s\n", sqlite3_errmsg(smsdb));
+	} else if (sqlite3_step(get_discovery_stmt) == SQLITE_ROW) {
+		tmp = (const char *) sqlite3_column_text(get_discovery_stmt, 0);
+		ast_copy_string(imei, S_OR(tmp, ""), imei_len);
+		tmp = (const char *) sqlite3_column_text(get_discovery_stmt, 1);
+		ast_copy_string(imsi, S_OR(tmp, ""), imsi_len);
+		res = 1;
+	}
+	sqlite3_reset(get_discovery_stmt);
+	ast_mutex_unlock(&dblock);
+
+	return res;
+}
+
+/*!
+ * \brief Store IMEI and IMSI of device for next start
+ * \param usb -- USB device path in sysfs
+ * \param identity -- ports and ids of device
+ * \param imei -- IMEI or NULL
+ * \param imsi -- IMSI or NULL
+ * \return 0 on success, -1 on error
+ */
+EXPORT_DEF int smsdb_discovery_put(const char *usb, const char *identity, const char *imei, const char *imsi)
+{
+	int res = 0;
+
+	if (!put_discovery_stmt) {
+		return -1;
+	}
+
+	ast_mutex_lock(&dblock);
+	if (sqlite3_bind_text(put_discovery_stmt, 1, usb, -1, SQLITE_STATIC) != SQLITE_OK
+			|| sqlite3_bind_text(put_discovery_stmt, 2, identity, -1, SQLITE_STATIC) != SQLITE_OK
+			|| sqlite3_bind_text(put_discovery_stmt, 3, imei, -1, SQLITE_STATIC) != SQLITE_OK
+			|| sqlite3_bind_text(put_discovery_stmt, 4, imsi, -1, SQLITE_STATIC) != SQLITE_OK) {
+		ast_log(LOG_WARNING, "Couldn't bind discovery to stmt: %s\n", sqlite3_errmsg(smsdb));
+		res = -1;
+	} else if (sqlite3_step(put_discovery_stmt) != SQLITE_DONE) {
+		ast_log(LOG_WARNING, "Couldn't store discovery of %s: %s\n", usb, sqlite3_errmsg(smsdb));
+		res = -1;
+	}
+	sqlite3_reset(put_discovery_stmt);
+	ast_mutex_unlock(&dblock);
+
+	return res;
+}
+
+/*!
+ * \brief Forget IMEI and IMSI of all devices, used when USB port map changed
+ * \return 0 on success, -1 on error
+ */
+EXPORT_DEF int smsdb_discovery_clear()
+{
+	int res = 0;
+
+	if (!clear_discovery_stmt) {
+		return -1;
+	}
+
+	ast_mutex_lock(&dblock);
+	if (sqlite3_step(clear_discovery_stmt) != SQLITE_DONE) {
+		ast_log(LOG_WARNING, "Couldn't clear discovery: %s\n", sqlite3_errmsg(smsdb));
+		res = -1;
+	}
+	sqlite3_reset(clear_discovery_stmt);
+	ast_mutex_unlock(&dblock);
+
+	return res;
+}
+
+/*!
+ * \brief Forget devices stored with IMEI or IMSI, used when device reports other ones
+ * \param imei -- IMEI or NULL
+ * \param imsi -- IMSI or NULL
+ * \return number of forgotten devices, -1 on error
+ */
+EXPORT_DEF int smsdb_discovery_forget(const char *imei, const char *imsi)
+{
+	int res = 0;
+
+	if (!forget_discovery_stmt) {
+		return -1;
+	}
+
+	ast_mutex_lock(&dblock);
+	if (sqlite3_bind_text(forget_discovery_stmt, 1, imei, -1, SQLITE_STATIC) != SQLITE_OK
+			|| sqlite3_bind_text(forget_discovery_stmt, 2, imsi, -1, SQLITE_STATIC) != SQLITE_OK) {
+		ast_log(LOG_WARNING, "Couldn't bind discovery to stmt: %s\n", sqlite3_errmsg(smsdb));
+		res = -1;
+	} else if (sqlite3_step(forget_discovery_stmt) != SQLITE_DONE) {
+		ast_log(LOG_WARNING, "Couldn't forget discovery: %s\n", sqlite3_errmsg(smsdb));
+		res = -1;
+	} else {
+		res = sqlite3_changes(smsdb);
+	}
+	sqlite3_reset(forget_discovery_stmt);
+	ast_mutex_unlock(&dblock);
+
+	return res;
+}
+
+/*!
+ * \brief Delete stored devices which USB path is gone
+ * \param exists -- returns non-zero if USB device path still exists
+ * \return number of deleted devices, -1 on error
+ */
+EXPORT_DEF int smsdb_discovery_prune(int (*exists)(const char *usb))
+{
+	char (*gone)[SMSDB_USB_MAX_LEN] = NULL;
+	int count = 0, size = 0;
+	int res = 0;
+	const char *usb;
+
+	if (!list_discovery_stmt || !del_discovery_stmt) {
+		return -1;
+	}
+
+	smsdb_begin_transaction();
+
+	/* collect first, rows are not deleted while select is stepping */
+	while (sqlite3_step(list_discovery_stmt) == SQLITE_ROW) {
+		usb = (const char *) sqlite3_column_text(list_discovery_stmt, 0);
+		if (!usb || exists(usb)) {
+			continue;
+		}
+		if (count == size) {
+			void *tmp = ast_realloc(gone, (size + 8) * sizeof(*gone));
+			if (!tmp) {
+				res = -1;
+				break;
+			}
+			gone = tmp;
+			size += 8;
+		}
+		ast_copy_string(gone[count++], usb, sizeof(*gone));
+	}
+	sqlite3_reset(list_discovery_stmt);
+
+	for (int i = 0; res >= 0 && i < count; ++i) {
+		if (sqlite3_bind_text(del_discovery_stmt, 1, gone[i], -1, SQLITE_STATIC) != SQLITE_OK) {
+			ast_log(LOG_WARNING, "Couldn't bind USB path to stmt: %s\n", sqlite3_errmsg(smsdb));
+			res = -1;
+		} else if (sqlite3_step(del_discovery_stmt) != SQLITE_DONE) {
+			res = -1;
+		}
+		sqlite3_reset(del_discovery_stmt);
+	}
+
+	if (res < 0) {
+		smsdb_rollback_transaction();
+	} else {
+		smsdb_commit_transaction();
+		res = count;
+	}
+	ast_free(gone);
+
+	return res;
+}
+
 /*!
  * \internal
  * \brief Clean up resources on Asterisk shutdown
@@ -6,12 +6,27 @@
 #define CHAN_QUECTEL_SMSDB_H_INCLUDED
 
 #include "export.h"			/* EXPORT_DECL EXPORT_DEF */
+#include "pdu.h"			/* pdu_part_t */
 
 #define SMSDB_PAYLOAD_MAX_LEN 4096
 #define SMSDB_DST_MAX_LEN 256
+#define SMSDB_USB_MAX_LEN 64		/* USB device path in sysfs, see smsdb_discovery_put() */
+
+/* state of outgoing part not yet confirmed by +CMGS */
+#define SMSDB_PDU_SPOOLED 0		/* held in memory by device */
+#define SMSDB_PDU_SENDING 1		/* written to device queue */
+#define SMSDB_PDU_WAITING 2		/* waiting for smsdb_outgoing_resume() */
+
+/* outgoing parts not confirmed by +CMGS of one device, see smsdb_outgoing_backlog() */
+struct smsdb_backlog {
+	char dev[32];
+	int parts;
+};
 
 EXPORT_DECL int smsdb_init();
 EXPORT_DECL void smsdb_atexit();
+EXPORT_DECL int smsdb_batch_begin();
+EXPORT_DECL int smsdb_batch_end();
 EXPORT_DECL int smsdb_put(const char *id, const char *addr, int ref, int parts, int order, const char *msg, char *out);
 EXPORT_DECL int smsdb_get_refid(const char *id, const char *addr);
 EXPORT_DECL int smsdb_outgoing_add(const char *id, const char *addr, int cnt, int ttl, int srr, const char *payload, size_t len);
@@ -19,5 +34,17 @@ EXPORT_DECL ssize_t smsdb_outgoing_clear(int uid, char *dst, char *payload);
 EXPORT_DECL ssize_t smsdb_outgoing_part_put(int uid, int refid, char *dst, char *payload);
 EXPORT_DECL ssize_t smsdb_outgoing_part_status(const char *id, const char *addr, int mr, int st, int *status_all, char *payload);
 EXPORT_DECL ssize_t smsdb_outgoing_purge_one(char *dst, char *payload);
+EXPORT_DECL int smsdb_outgoing_pdu_add(int uid, int part, int grp, const pdu_part_t *pdu);
+EXPORT_DECL int smsdb_outgoing_pdu_sending(int uid);
+EXPORT_DECL int smsdb_outgoing_pdu_unspool(int uid, int first);
+EXPORT_DECL int smsdb_outgoing_pdu_reset(const char *id);
+EXPORT_DECL int smsdb_outgoing_backlog(struct smsdb_backlog **list);
+EXPORT_DECL int smsdb_outgoing_pdu_failed(int uid, int retries, int delay);
+EXPORT_DECL int smsdb_discovery_get(const char *usb, const char *identity, char *imei, size_t imei_len, char *imsi, size_t imsi_len);
+EXPORT_DECL int smsdb_discovery_put(const char *usb, const char *identity, const char *imei, const char *imsi);
+EXPORT_DECL int smsdb_discovery_clear();
+EXPORT_DECL int smsdb_discovery_forget(const char *imei, const char *imsi);
+EXPORT_DECL int smsdb_discovery_prune(int (*exists)(const char *usb));
+EXPORT_DECL pdu_part_t *smsdb_outgoing_resume(const char *id, int grp, int takeover, int *uid, unsigned *parts);
 
 #endif
@@ -0,0 +1,386 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "char_conv.h"			/* utf8_to_ucs2() ucs2_to_utf8() hexify() unhex() */
+#include "mutils.h"			/* ITEMS_OF() */
+#include "gsm7_luts.h"			/* LUT_GSM7_LS16 LUT_GSM7_SS16 */
+
+int ok = 0;
+int faults = 0;
+
+static const char * const texts[] = {
+	"",
+	"Hello. This is a plain GSM7 message",
+	"multiplé SMS with latin-1 characters: äöüß",
+	"Привет, это сообщение на русском языке",
+	"漢字とかなの混じった日本語のメッセージ",
+	"hello world😋 with emoji 🇩🇪",
+	"\x7f\xc2\x80\xdf\xbf\xe0\xa0\x80\xef\xbf\xbf\xf0\x90\x80\x80\xf4\x8f\xbf\xbf",
+};
+
+/* invalid input, both implementations must fail */
+static const char * const bad_utf8[] = {
+	"\x80",				/* lone continuation byte */
+	"\xc0\xaf",			/* overlong */
+	"\xe0\x80\xaf",			/* overlong */
+	"\xed\xa0\x80",			/* surrogate */
+	"\xf4\x90\x80\x80",		/* above U+10FFFF */
+	"abc\xe2\x82",			/* truncated */
+	"\xff",
+};
+
+static const uint8_t bad_ucs2[][4] = {
+	{ 0xD8, 0x3D, 0x00, 0x41 },	/* high surrogate without low one */
+	{ 0xDE, 0x0B, 0x00, 0x41 },	/* lone low surrogate */
+};
+
+#/* */
+static void check(int cond, const char * what, int idx)
+{
+	if (cond) {
+		++ok;
+	} else {
+		++faults;
+		fprintf(stderr, "Check %s %d unsuccessful\n", what, idx);
+	}
+}
+
+#/* */
+void test_conv()
+{
+	uint16_t u1[256], u2[256];
+	char s1[1024], s2[1024];
+	ssize_t r1, r2;
+	unsigned i;
+
+	for (i = 0; i < ITEMS_OF(texts); ++i) {
+		r1 = utf8_to_ucs2(texts[i], strlen(texts[i]), u1, ITEMS_OF(u1));
+		r2 = utf8_to_ucs2_iconv(texts[i], strlen(texts[i]), u2, ITEMS_OF(u2));
+		check(r1 >= 0 && r1 == r2 && !memcmp(u1, u2, r1 * 2), "utf8_to_ucs2", i);
+
+		r1 = ucs2_to_utf8(u1, r1, s1, sizeof(s1));
+		r2 = ucs2_to_utf8_iconv(u2, r2, s2, sizeof(s2));
+		check(r1 >= 0 && r1 == r2 && !memcmp(s1, s2, r1) && (size_t) r1 == strlen(texts[i]) && !memcmp(s1, texts[i], r1), "ucs2_to_utf8", i);
+	}
+
+	for (i = 0; i < ITEMS_OF(bad_utf8); ++i) {
+		r1 = utf8_to_ucs2(bad_utf8[i], strlen(bad_utf8[i]), u1, ITEMS_OF(u1));
+		r2 = utf8_to_ucs2_iconv(bad_utf8[i], strlen(bad_utf8[i]), u2, ITEMS_OF(u2));
+		check(r1 < 0 && r2 < 0, "bad utf8", i);
+	}
+
+	for (i = 0; i < ITEMS_OF(bad_ucs2); ++i) {
+		r1 = ucs2_to_utf8((const uint16_t *) bad_ucs2[i], 2, s1, sizeof(s1));
+		r2 = ucs2_to_utf8_iconv((const uint16_t *) bad_ucs2[i], 2, s2, sizeof(s2));
+		check(r1 < 0 && r2 < 0, "bad ucs2", i);
+	}
+
+	/* output buffer too small, one unit is kept for terminating zero */
+	r1 = utf8_to_ucs2("abcd", 4, u1, 4);
+	r2 = utf8_to_ucs2_iconv("abcd", 4, u2, 4);
+	check(r1 < 0 && r2 < 0, "short buffer", 0);
+	r1 = utf8_to_ucs2("abcd", 4, u1, 5);
+	r2 = utf8_to_ucs2_iconv("abcd", 4, u2, 5);
+	check(r1 == 4 && r2 == 4, "short buffer", 1);
+}
+
+#/* bit at a time packer, as in the former gsm7_pack() */
+static ssize_t ref_gsm7_pack(const uint16_t *in, size_t in_length, char *out, size_t out_size, unsigned out_padding)
+{
+	size_t i, x;
+	unsigned value = 0;
+
+	/* compute number of bytes we need for the final string, rounded up */
+	x = ((out_padding + (7 * in_length) + 7) / 8) + 1;
+
+	/* check that the buffer is not too small */
+	if (x > out_size)
+		return -1;
+
+	for (x = i = 0; i != in_length; i++) {
+		char c[] = { in[i] >> 8, in[i] & 255 };
+
+		for (int j = c[0] == 0; j < 2; ++j) {
+			value |= (c[j] & 0x7F) << out_padding;
+			out_padding += 7;
+			if (out_padding < 8)
+				continue;
+			/* output one byte */
+			out[x++] = value & 0xff;
+			value >>= 8;
+			out_padding -= 8;
+		}
+	}
+	if (out_padding != 0) {
+		out[x++] = value & 0xff;
+	}
+
+	/* return total string length in nibbles, excluding terminating zero */
+	return x * 2 - (out_padding == 1 || out_padding == 2 || out_padding == 3 ? 1 : 0);
+}
+
+#/* nibble at a time decoder, as in the former gsm7_unpack_decode() */
+static ssize_t ref_gsm7_unpack_decode(const char *in, size_t in_nibbles, uint16_t *out, size_t out_size, unsigned in_padding, uint8_t ls, uint8_t ss)
+{
+	if (ls > 13) ls = 0;
+	if (ss > 13) ss = 0;
+	size_t i;
+	size_t x;
+	unsigned value = 0;
+	unsigned c;
+
+	if (out_size == 0) {
+		return -1;
+	}
+
+	/* check if string is empty */
+	if (in_nibbles < 2) {
+		out[0] = '\0';
+		return 0;
+	}
+
+	/* account for the bit padding */
+	in_padding = 7 - in_padding;
+
+	/* parse the hexstring */
+	int esc = 0;
+	for (x = i = 0; i < in_nibbles; ++i) {
+		if (x >= out_size)
+			return -1;
+		c = in[i / 2];
+		if (i & 1) c >>= 4;
+		uint8_t n = c & 0xf;
+		value |= n << in_padding;
+		in_padding += 4;
+
+		while (in_padding >= 7 * 2) {
+			in_padding -= 7;
+			value >>= 7;
+			{
+				uint16_t val = (esc ? LUT_GSM7_SS16 : LUT_GSM7_LS16)[esc ? ss : ls][value & 0x7f];
+				if (val == 0x1b) {
+					esc = 1;
+				} else {
+					esc = 0;
+					out[x++] = ((val & 0xff) << 8) | (val >> 8);
+				}
+			}
+		}
+	}
+
+	return x;
+}
+
+#/* random septets, with escapes if esc is set */
+static void gsm7_random(uint16_t *buf, size_t len, int esc)
+{
+	for (size_t i = 0; i < len; ++i) {
+		buf[i] = rand() & 0x7f;
+		if (esc && buf[i] == 0x1b) {
+			buf[i] = (0x1b << 8) | (rand() & 0x7f);
+		}
+	}
+}
+
+#/* */
+void test_gsm7()
+{
+	uint16_t in[300], u1[400], u2[400];
+	char p1[320], p2[320];
+	unsigned len, pad, round, idx = 0;
+	ssize_t r1, r2;
+
+	srand(2);
+	for (round = 0; round < 4; ++round) {
+		for (len = 0; len <= 280; ++len) {
+			gsm7_random(in, len, round & 1);
+			for (pad = 0; pad < 7; ++pad, ++idx) {
+				ssize_t packed;
+				size_t nib;
+
+				memset(p1, 0x55, sizeof(p1));
+				memset(p2, 0x55, sizeof(p2));
+				packed = gsm7_pack(in, len, p1, sizeof(p1), pad);
+				r2 = ref_gsm7_pack(in, len, p2, sizeof(p2), pad);
+				check(packed == r2 && (packed < 0 || !memcmp(p1, p2, (packed + 1) / 2)), "gsm7_pack", idx);
+				if (packed < 0) {
+					continue;
+				}
+
+				/* every nibble count up to the packed one, random tables */
+				for (nib = round < 2 ? (size_t) packed : 0; nib <= (size_t) packed; ++nib) {
+					uint8_t ls = (round & 2) ? rand() % 14 : 0;
+					uint8_t ss = (round & 2) ? rand() % 14 : 0;
+					r1 = gsm7_unpack_decode(p1, nib, u1, ITEMS_OF(u1), pad, ls, ss);
+					r2 = ref_gsm7_unpack_decode(p1, nib, u2, ITEMS_OF(u2), pad, ls, ss);
+					if (r1 != r2 || (r1 > 0 && memcmp(u1, u2, r1 * 2))) {
+						break;
+					}
+				}
+				check(nib > (size_t) packed, "gsm7_unpack_decode", idx);
+			}
+		}
+	}
+
+	/* short output buffers */
+	gsm7_random(in, 100, 0);
+	ref_gsm7_pack(in, 100, p2, sizeof(p2), 3);
+	for (len = 0; len <= 120; ++len) {
+		r1 = gsm7_pack(in, 100, p1, len, 3);
+		r2 = ref_gsm7_pack(in, 100, p2, len, 3);
+		check(r1 == r2 && (r1 < 0 || !memcmp(p1, p2, (r1 + 1) / 2)), "gsm7_pack short", len);
+		r1 = gsm7_unpack_decode(p2, 175, u1, len, 3, 0, 0);
+		r2 = ref_gsm7_unpack_decode(p2, 175, u2, len, 3, 0, 0);
+		check(r1 == r2 && (r1 < 0 || !memcmp(u1, u2, r1 * 2)), "gsm7_unpack_decode short", len);
+	}
+}
+
+static const char hexdigits[] = "0123456789ABCDEF";
+
+#/* */
+void test_hex()
+{
+	uint8_t bin[300], dec[601];
+	char hex[601], ref[601];
+	unsigned len, i;
+	ssize_t r;
+
+	srand(1);
+	for (i = 0; i < sizeof(bin); ++i) {
+		bin[i] = rand();
+	}
+
+	for (len = 0; len <= sizeof(bin); ++len) {
+		for (i = 0; i < len; ++i) {
+			ref[i * 2] = hexdigits[bin[i] >> 4];
+			ref[i * 2 + 1] = hexdigits[bin[i] & 15];
+		}
+		ref[len * 2] = '\0';
+
+		r = hexify(bin, len, hex);
+		check(r == len * 2 && !strcmp(hex, ref), "hexify", len);
+
+		r = unhex_len(hex, len * 2, dec);
+		check(r == len * 2 && !memcmp(dec, bin, len), "unhex", len);
+
+		/* in place both ways */
+		memcpy(dec, bin, len);
+		hexify(dec, len, (char *) dec);
+		check(!strcmp((char *) dec, ref), "hexify in place", len);
+		r = unhex((char *) dec, dec);
+		check(r == len * 2 && !memcmp(dec, bin, len), "unhex in place", len);
+	}
+
+	/* lower case, odd number of digits */
+	r = unhex_len("a1b2c", 5, dec);
+	check(r == 5 && dec[0] == 0xA1 && dec[1] == 0xB2 && dec[2] == 0xC0, "unhex odd", 0);
+
+	/* invalid digit at every position of blocks */
+	hexify(bin, 128, hex);
+	for (i = 0; i < 256; ++i) {
+		static const char bad[] = "g/:@G`\x80 ";
+		char saved = hex[i];
+		hex[i] = bad[i % (sizeof(bad) - 1)];
+		check(unhex_len(hex, 256, dec) < 0, "unhex invalid", i);
+		hex[i] = saved;
+	}
+}
+
+#/* */
+static double bench(ssize_t (*fn)(const char *, size_t, uint16_t *, size_t), ssize_t (*back)(const uint16_t *, size_t, char *, size_t), const char * text, unsigned rounds)
+{
+	uint16_t u[256];
+	char s[1024];
+	struct timespec t0, t1;
+	size_t len = strlen(text);
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for (unsigned i = 0; i < rounds; ++i) {
+		ssize_t n = fn(text, len, u, ITEMS_OF(u));
+		back(u, n, s, sizeof(s));
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+
+	return ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) / rounds;
+}
+
+#/* */
+void bench_conv()
+{
+	static const unsigned rounds = 100000;
+	unsigned i;
+
+	for (i = 1; i < 5; ++i) {
+		double hand = bench(utf8_to_ucs2, ucs2_to_utf8, texts[i], rounds);
+		double ic = bench(utf8_to_ucs2_iconv, ucs2_to_utf8_iconv, texts[i], rounds);
+		fprintf(stderr, "round trip of %zu bytes: %.0f ns, iconv %.0f ns\n", strlen(texts[i]), hand, ic);
+	}
+}
+
+#/* */
+void bench_hex()
+{
+	static const unsigned rounds = 10000;
+	static uint8_t bin[8192];
+	static char hex[sizeof(bin) * 2 + 1];
+	struct timespec t0, t1;
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for (unsigned i = 0; i < rounds; ++i) {
+		hexify(bin, sizeof(bin), hex);
+		unhex_len(hex, sizeof(bin) * 2, bin);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+
+	fprintf(stderr, "hex round trip of %zu bytes: %.0f ns\n", sizeof(bin),
+		((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) / rounds);
+}
+
+#/* */
+static double bench_gsm7_fn(ssize_t (*pack)(const uint16_t *, size_t, char *, size_t, unsigned), ssize_t (*unpack)(const char *, size_t, uint16_t *, size_t, unsigned, uint8_t, uint8_t), const uint16_t *in, size_t len, unsigned rounds)
+{
+	uint16_t u[200];
+	char packed[160];
+	struct timespec t0, t1;
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for (unsigned i = 0; i < rounds; ++i) {
+		ssize_t n = pack(in, len, packed, sizeof(packed), 0);
+		unpack(packed, n, u, ITEMS_OF(u), 0, 0, 0);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+
+	return ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) / rounds;
+}
+
+#/* */
+void bench_gsm7()
+{
+	static const unsigned rounds = 100000;
+	uint16_t in[160];
+
+	gsm7_random(in, ITEMS_OF(in), 0);
+	fprintf(stderr, "gsm7 round trip of %zu septets: %.0f ns, bit at a time %.0f ns\n", ITEMS_OF(in),
+		bench_gsm7_fn(gsm7_pack, gsm7_unpack_decode, in, ITEMS_OF(in), rounds),
+		bench_gsm7_fn(ref_gsm7_pack, ref_gsm7_unpack_decode, in, ITEMS_OF(in), rounds));
+}
+
+#/* */
+int main()
+{
+	test_conv();
+	test_hex();
+	test_gsm7();
+	bench_conv();
+	bench_hex();
+	bench_gsm7();
+
+	fprintf(stderr, "done %d tests: %d OK %d FAILS\n", ok + faults, ok, faults);
+
+	if (faults) {
+		return 1;
+	}
+	return 0;
+}
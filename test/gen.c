@@ -2,7 +2,6 @@
 #include <string.h>
 
 #include "pdu.h"
-#include "gsm7_luts.h"
 
 int ok = 0;
 int faults = 0;
@@ -84,11 +83,161 @@ void test_pdu_build()
 	}
 }
 
+#/* */
+void test_pdu_iter()
+{
+	/* escaped characters must not be split across parts */
+	static const char pattern[] = "0123456789{}";
+	uint16_t ucs2[1000];
+	pdu_part_t pdu;
+	pdu_iter_t iter;
+	unsigned len, i;
+
+	for (len = 150; len < sizeof(ucs2) / sizeof(ucs2[0]); len += 37) {
+		for (i = 0; i < len; ++i) {
+			ucs2[i] = pattern[i % (sizeof(pattern) - 1)];
+		}
+		int cnt = pdu_iter_init(&iter, "", "+46708251358", ucs2, len, 60, 0, 1), n = 0;
+		while (pdu_iter_next(&iter, &pdu) > 0) {
+			if (pdu.tpdu_length > TPDU_LENGTH) {
+				break;
+			}
+			++n;
+		}
+		if (cnt > 0 && n == cnt && iter.off == len) {
+			++ok;
+		} else {
+			++faults;
+			fprintf(stderr, "Check iter %u unsuccessful: %d parts announced, %d built\n", len, cnt, n);
+		}
+	}
+}
+
+#/* */
+void test_pdu_national()
+{
+	static const struct {
+		const char *in;
+		int ls, ss, parts;
+	} tests[] = {
+		{ "Şişli'de güzel bir gün, İstanbul ğüşıöç", 1, 0, 1 },
+		{ "¿Qué tal? Ñandú, él está aquí: ÁÍÓÚ", 0, 2, 1 },
+		{ "Não há ação sem emoção, você está lá? Três irmãs.", -1, -1, 1 },
+		{ "Çok güzel! Şimdi İstanbul'dayız, ağaçların altında oturup çay içiyoruz. Yarın Ankara'ya gideceğiz, "
+		  "oradan da İzmir'e geçeceğiz. Hava çok sıcak ama deniz kenarı serin. Görüşmek üzere, sevgiler! "
+		  "Hafta sonu için planlarınızı da yazın lütfen, ışıklar şehrin üstünde yanıp sönüyor.", 1, 0, 2 },
+	};
+	uint16_t ucs2[512], out[1024], joined[1024];
+	pdu_part_t pdu;
+	pdu_iter_t iter;
+	unsigned i;
+
+	for (i = 0; i < sizeof(tests) / sizeof(tests[0]); ++i) {
+		int len = utf8_to_ucs2(tests[i].in, strlen(tests[i].in), ucs2, sizeof(ucs2) / sizeof(ucs2[0]));
+		int cnt = pdu_iter_init(&iter, "", "+46708251358", ucs2, len, 60, 0, 1), n = 0, total = 0, good = 1;
+
+		if (cnt != tests[i].parts || iter.dcs != 0 || (tests[i].ls >= 0 && (iter.udh.ls != tests[i].ls || iter.udh.ss != tests[i].ss))) {
+			good = 0;
+		}
+
+		/* decode user data back with tables announced in UDH */
+		while (good && pdu_iter_next(&iter, &pdu) > 0) {
+			const uint8_t *ud = pdu.buffer + 15;
+			unsigned udl = pdu.buffer[14], udhl = ud[0], k;
+			int nibbles = (udl * 7 + 3) / 4, ls = 0, ss = 0, order = 0, res;
+
+			for (k = 1; k + 1 < udhl + 1; k += 2 + ud[k + 1]) {
+				if (ud[k] == 0x00) {
+					order = ud[k + 4];
+				} else if (ud[k] == 0x24) {
+					ss = ud[k + 2];
+				} else if (ud[k] == 0x25) {
+					ls = ud[k + 2];
+				}
+			}
+			if (!(pdu.buffer[1] & 0x40) || ls != iter.udh.ls || ss != iter.udh.ss || (cnt > 1 && order != n + 1)) {
+				good = 0;
+				break;
+			}
+
+			nibbles -= (udhl + 1) * 2;
+			res = gsm7_unpack_decode((const char *) ud + udhl + 1, nibbles, out, sizeof(out) / sizeof(out[0]), 6 - udhl % 7, ls, ss);
+			if (res < 0 || total + res > len) {
+				good = 0;
+				break;
+			}
+			memcpy(joined + total, out, res * 2);
+			total += res;
+			++n;
+		}
+
+		if (good && n == cnt && total == len && !memcmp(joined, ucs2, len * 2)) {
+			++ok;
+		} else {
+			++faults;
+			fprintf(stderr, "Check national %u unsuccessful: %d parts, ls %d ss %d\n", i, cnt, iter.udh.ls, iter.udh.ss);
+		}
+	}
+}
+
+#/* */
+void test_pdu_boundary()
+{
+	/* 'a' needs no table, dotless 'ı' only the Turkish locking shift one */
+	static const char * const chars[] = { "a", "ı" };
+	char utf8[400];
+	uint16_t ucs2[200];
+	pdu_part_t pdu;
+	pdu_iter_t iter;
+	unsigned c, len, i;
+
+	for (c = 0; c < sizeof(chars) / sizeof(chars[0]); ++c) {
+		for (len = 145; len <= 165; ++len) {
+			int cnt, n = 0, good = 1;
+
+			utf8[0] = 0;
+			for (i = 0; i < len; ++i) {
+				strcat(utf8, chars[c]);
+			}
+			utf8_to_ucs2(utf8, strlen(utf8), ucs2, sizeof(ucs2) / sizeof(ucs2[0]));
+			cnt = pdu_iter_init(&iter, "", "+46708251358", ucs2, len, 60, 0, 1);
+			if (iter.dcs != 0 || iter.udh.ls != c) {
+				good = 0;
+			}
+			while (good && pdu_iter_next(&iter, &pdu) > 0) {
+				const uint8_t *ud = pdu.buffer + 15;
+				unsigned udl = pdu.buffer[14], udhl = 0, k;
+				int concat = 0;
+
+				if (pdu.buffer[1] & 0x40) {
+					udhl = ud[0];
+					for (k = 1; k + 1 < udhl + 1; k += 2 + ud[k + 1]) {
+						concat |= ud[k] == 0x00;
+					}
+				}
+				/* every part fits, concatenated parts are announced */
+				if (udl > 160 || pdu.tpdu_length > TPDU_LENGTH || concat != (cnt > 1)) {
+					good = 0;
+				}
+				++n;
+			}
+			if (good && cnt > 0 && n == cnt && iter.off == len) {
+				++ok;
+			} else {
+				++faults;
+				fprintf(stderr, "Check boundary %s x %u unsuccessful: %d parts announced, %d built\n", chars[c], len, cnt, n);
+			}
+		}
+	}
+}
 
 #/* */
 int main()
 {
 	test_pdu_build();
+	test_pdu_iter();
+	test_pdu_national();
+	test_pdu_boundary();
 	
 	fprintf(stderr, "done %d tests: %d OK %d FAILS\n", ok + faults, ok, faults);
 
@@ -1,6 +1,47 @@
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
 #include "mixbuffer.h"
 #include "helpers.h"
+#include "histogram.h"
+
+int ok = 0;
+int faults = 0;
+
+#/* */
+static void check(int cond, const char * what, unsigned idx)
+{
+	if (cond) {
+		++ok;
+	} else {
+		++faults;
+		fprintf(stderr, "Check %s %u unsuccessful\n", what, idx);
+	}
+}
+
+#/* copy data of io vectors to out, return length */
+static size_t iov_join(const struct iovec * iov, int iovcnt, char * out)
+{
+	size_t len = 0;
+
+	for (int i = 0; i < iovcnt; ++i) {
+		memcpy(out + len, iov[i].iov_base, iov[i].iov_len);
+		len += iov[i].iov_len;
+	}
+	return len;
+}
+
+#/* offset of first mem in data, -1 if none */
+static ssize_t ref_find(const char * data, size_t len, const char * mem, size_t mlen)
+{
+	for (size_t i = 0; i + mlen <= len; ++i) {
+		if (!memcmp(data + i, mem, mlen)) {
+			return i;
+		}
+	}
+	return -1;
+}
 
 void hex_encode(unsigned char * bytes, unsigned length)
 {
@@ -95,9 +136,301 @@ void test_suite1()
 	
 }
 
+#/* same operations on plain and mirrored ring buffer must give the same data */
+void test_suite2()
+{
+	static const char alphabet[] = "ab\r\nOK";
+	static const char * terms[] = { "\r\n", "\r\nOK", "\n\r\nOK\r\n" };
+	struct ringbuffer rbs[2];
+	struct iovec iov[2][2];
+	char * plain, * data, * out[2];
+	size_t size, len[2];
+	int cnt[2];
+	unsigned i, k, m;
+
+	if (rb_init_mirror(&rbs[1], 1)) {
+		fprintf(stderr, "Mirrored ring buffer is not available, skipped\n");
+		return;
+	}
+	size = rbs[1].size;
+	plain = malloc(size);
+	data = malloc(size);
+	out[0] = malloc(size);
+	out[1] = malloc(size);
+	rb_init(&rbs[0], plain, size);
+
+	fprintf(stderr, "Testing plain and mirrored ring buffers of %u bytes\n", (unsigned) size);
+	srand(1);
+	for (i = 0; i < 20000; ++i) {
+		size_t n = rand() % (size / 3);
+
+		for (k = 0; k < n; ++k) {
+			data[k] = alphabet[rand() % (sizeof(alphabet) - 1)];
+		}
+
+		switch (rand() % 3) {
+		case 0:
+			len[0] = rb_write(&rbs[0], data, n);
+			len[1] = rb_write(&rbs[1], data, n);
+			check(len[0] == len[1], "rb_write", i);
+			break;
+		case 1:
+			/* as at_read() does */
+			for (k = 0; k < 2; ++k) {
+				cnt[k] = rb_write_iov(&rbs[k], iov[k]);
+				len[k] = 0;
+				for (int j = 0; j < cnt[k] && len[k] < n; ++j) {
+					size_t part = iov[k][j].iov_len < n - len[k] ? iov[k][j].iov_len : n - len[k];
+					memcpy(iov[k][j].iov_base, data + len[k], part);
+					len[k] += part;
+				}
+				rb_write_upd(&rbs[k], len[k]);
+			}
+			check(len[0] == len[1] && cnt[1] <= 1, "rb_write_iov", i);
+			break;
+		default:
+			len[0] = rb_read_upd(&rbs[0], n);
+			len[1] = rb_read_upd(&rbs[1], n);
+			check(len[0] == len[1], "rb_read_upd", i);
+			break;
+		}
+		check(rb_used(&rbs[0]) == rb_used(&rbs[1]) && rbs[0].read == rbs[1].read, "rb_used", i);
+
+		for (k = 0; k < 2; ++k) {
+			cnt[k] = rb_read_all_iov(&rbs[k], iov[k]);
+			len[k] = iov_join(iov[k], cnt[k], out[k]);
+		}
+		check(len[0] == len[1] && !memcmp(out[0], out[1], len[0]) && cnt[1] <= 1, "rb_read_all_iov", i);
+		check(rb_memcmp(&rbs[0], out[0], len[0] / 2) == rb_memcmp(&rbs[1], out[0], len[0] / 2), "rb_memcmp", i);
+
+		n = rb_used(&rbs[0]) ? rand() % rb_used(&rbs[0]) : 0;
+		for (k = 0; k < 2; ++k) {
+			cnt[k] = rb_read_n_iov(&rbs[k], iov[k], n);
+			len[k] = iov_join(iov[k], cnt[k], out[k]);
+		}
+		check(len[0] == len[1] && !memcmp(out[0], out[1], len[0]) && cnt[1] <= 1, "rb_read_n_iov", i);
+
+		for (k = 0; k < 2; ++k) {
+			cnt[k] = rb_read_until_char_iov(&rbs[k], iov[k], '\n');
+			len[k] = iov_join(iov[k], cnt[k], out[k]);
+		}
+		check(!cnt[0] == !cnt[1] && len[0] == len[1] && !memcmp(out[0], out[1], len[0]) && cnt[1] <= 1, "rb_read_until_char_iov", i);
+
+		n = iov_join(iov[0], rb_read_all_iov(&rbs[0], iov[0]), data);
+		for (m = 0; m < ITEMS_OF(terms); ++m) {
+			ssize_t ref = ref_find(data, n, terms[m], strlen(terms[m]));
+
+			for (k = 0; k < 2; ++k) {
+				cnt[k] = rb_read_until_mem_iov(&rbs[k], iov[k], terms[m], strlen(terms[m]));
+				len[k] = iov_join(iov[k], cnt[k], out[k]);
+			}
+			check(!cnt[0] == !cnt[1] && len[0] == len[1] && !memcmp(out[0], out[1], len[0]) && cnt[1] <= 1, "rb_read_until_mem_iov", i);
+			check(ref < 0 ? !cnt[0] : cnt[0] && len[0] == (size_t) ref, "rb_read_until_mem_iov ref", i);
+
+			/* search resumed over calls must find the same */
+			if (m == ITEMS_OF(terms) - 1) {
+				for (k = 0; k < 2; ++k) {
+					cnt[k] = rb_scan_until_mem_iov(&rbs[k], iov[k], terms[m], strlen(terms[m]));
+					len[k] = iov_join(iov[k], cnt[k], out[k]);
+				}
+				check(ref < 0 ? !cnt[0] && !cnt[1] : cnt[0] && cnt[1] && len[0] == (size_t) ref && len[1] == (size_t) ref, "rb_scan_until_mem_iov", i);
+			}
+		}
+	}
+
+	rb_fini(&rbs[1]);
+	free(out[1]);
+	free(out[0]);
+	free(data);
+	free(plain);
+}
+
+#/* mixing into plain and mirrored mix buffers must give the same data */
+void test_suite3()
+{
+	/* data is mixed as 16 bit samples, keep lengths even */
+	static const char x1[] = { 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00 };
+	static const char x2[] = { 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00 };
+	static const char x3[] = { 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00 };
+	static const char * strings[] = { x1, x2, x3 };
+	char buffer[40], out[2][40];
+	struct mixbuffer mb[2];
+	struct mixstream locals[2][3];
+	struct iovec iov[2];
+	unsigned i, k;
+
+	memset(&mb[1], 0, sizeof(mb[1]));
+	if (mixb_init_mirror(&mb[1], sizeof(buffer))) {
+		fprintf(stderr, "Mirrored mix buffer is not available, skipped\n");
+		return;
+	}
+	memset(buffer, 0, sizeof(buffer));
+	memset(mb[1].rb.buffer, 0, mb[1].rb.size);
+	mixb_init(&mb[0], buffer, sizeof(buffer));
+
+	fprintf(stderr, "Testing plain and mirrored mix buffers\n");
+	for (k = 0; k < 2; ++k) {
+		for (i = 0; i < ITEMS_OF(locals[k]); i++) {
+			mixb_attach(&mb[k], &locals[k][i]);
+		}
+	}
+
+	for (i = 0; i < 500; i++) {
+		int idx = i % ITEMS_OF(strings);
+		unsigned length = strlen(strings[idx]);
+		int lbuf = (i * 7) % ITEMS_OF(locals[0]);
+		size_t len[2];
+
+		for (k = 0; k < 2; ++k) {
+			if (mixb_free(&mb[k], &locals[k][lbuf]) < length) {
+				mixb_read_upd(&mb[k], length - mixb_free(&mb[k], &locals[k][lbuf]));
+			}
+			mixb_write(&mb[k], &locals[k][lbuf], strings[idx], length);
+			len[k] = iov_join(iov, mixb_read_all_iov(&mb[k], iov), out[k]);
+			if (i % 5 == 4) {
+				mixb_read_upd(&mb[k], len[k] / 4 * 2);
+			}
+		}
+		check(len[0] == len[1] && !memcmp(out[0], out[1], len[0]) && locals[0][lbuf].used == locals[1][lbuf].used, "mixb_write", i);
+	}
+
+	for (k = 0; k < 2; ++k) {
+		for (i = 0; i < ITEMS_OF(locals[k]); i++) {
+			mixb_detach(&mb[k], &locals[k][i]);
+		}
+	}
+	mixb_fini(&mb[1]);
+}
+
+#/* */
+void test_suite4()
+{
+	static const struct {
+		uint64_t	value;
+		unsigned	bucket;
+	} bounds[] = {
+		{ 0, 0 }, { 1, 0 }, { 2, 1 }, { 3, 1 }, { 4, 2 }, { 1023, 9 }, { 1024, 10 },
+		{ (1ull << (HIST_BUCKETS - 1)) - 1, HIST_BUCKETS - 2 }, { 1ull << (HIST_BUCKETS - 1), HIST_BUCKETS - 1 }, { ~0ull, HIST_BUCKETS - 1 },
+	};
+	struct histogram hist, copy, merged;
+	unsigned i;
+
+	fprintf(stderr, "Testing histograms\n");
+	for (i = 0; i < ITEMS_OF(bounds); i++) {
+		check(hist_bucket(bounds[i].value) == bounds[i].bucket, "hist_bucket", i);
+	}
+
+	memset(&hist, 0, sizeof(hist));
+	check(hist_percentile(&hist, 50) == 0, "hist_percentile", 0);
+
+	/* 90 values of 100 and 10 of 5000 */
+	for (i = 0; i < 100; i++) {
+		hist_add(&hist, i < 90 ? 100 : 5000);
+	}
+	hist_copy(&copy, &hist);
+	check(copy.count == 100 && copy.sum == 90 * 100 + 10 * 5000 && copy.max == 5000, "hist_copy", 0);
+	check(hist_percentile(&copy, 50) == 127, "hist_percentile", 1);
+	check(hist_percentile(&copy, 90) == 127, "hist_percentile", 2);
+	check(hist_percentile(&copy, 99) == 5000, "hist_percentile", 3);
+
+	memset(&merged, 0, sizeof(merged));
+	hist_merge(&merged, &copy);
+	hist_merge(&merged, &copy);
+	check(merged.count == 200 && merged.max == 5000 && merged.buckets[hist_bucket(100)] == 180, "hist_merge", 0);
+}
+
+#/* responses as received from modems */
+static const char * const traces[] = {
+	/* AT+CLCC with two calls */
+	"\r\n+CLCC: 1,0,0,0,0,\"+79139131234\",145,\"\",0,1\r\n+CLCC: 2,1,5,0,0,\"+79139135678\",145,\"\",0,1\r\n\r\nOK\r\n",
+	/* AT+CMGR of a concatenated UCS-2 part */
+	"\r\n+CMGR: 0,,159\r\n07919761989901F0440B919761100032F30008121021310454218C0500030B02010041002000740065007800740020007700690074006800200063007900720069006C006C00690063003A00200041043F04400438043204350442002C00200434043E0020043A043E043D04460430002004340430043D043D044B04450020043F043E043B043D043E0435002004410020043D04350441043A043E043B044C043A0438043C04380020003200200441043B043E04320430043C0438\r\n\r\nOK\r\n",
+	/* unsolicited lines and a data connection */
+	"\r\nRING\r\n\r\n+CLIP: \"+79139131234\",145,,,,0\r\n\r\n^RSSI:17\r\n\r\nCONNECT 256\r\n",
+	"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZab\r\n\r\nOK\r\n",
+};
+
+#/* */
+static int until_full(struct ringbuffer * rb, struct iovec iov[2], const void * mem, size_t len)
+{
+	return rb_read_until_mem_iov(rb, iov, mem, len);
+}
+
+#/* feed traces by chunks of readv() size and split them into responses as at_read_result_iov() does */
+static double bench_framer_fn(int (*until)(struct ringbuffer *, struct iovec [2], const void *, size_t), size_t chunk, unsigned rounds, unsigned * frames)
+{
+	static char buffer[4096];
+	struct ringbuffer rb;
+	struct iovec iov[2];
+	struct timespec t0, t1;
+
+	rb_init(&rb, buffer, sizeof(buffer));
+	*frames = 0;
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for (unsigned r = 0; r < rounds; ++r) {
+		for (unsigned t = 0; t < ITEMS_OF(traces); ++t) {
+			const char * p = traces[t];
+			size_t left = strlen(p);
+
+			while (left) {
+				size_t n = left < chunk ? left : chunk;
+
+				rb_write(&rb, p, n);
+				p += n;
+				left -= n;
+				for (;;) {
+					int cnt;
+
+					if (rb_memcmp(&rb, "+CMGR:", 6) == 0 || rb_memcmp(&rb, "+CLCC:", 6) == 0) {
+						cnt = until(&rb, iov, "\n\r\nOK\r\n", 7);
+						n = 7;
+					} else {
+						cnt = until(&rb, iov, "\r\n", 2);
+						n = 2;
+					}
+					if (cnt <= 0) {
+						break;
+					}
+					rb_read_upd(&rb, iov[0].iov_len + (cnt > 1 ? iov[1].iov_len : 0) + n);
+					++*frames;
+				}
+			}
+		}
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+
+	return ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) / rounds;
+}
+
+#/* */
+void bench_framer()
+{
+	static const unsigned rounds = 20000;
+	static const size_t chunks[] = { 8, 32, 256 };
+	unsigned frames[2];
+
+	for (unsigned i = 0; i < ITEMS_OF(chunks); ++i) {
+		double scan = bench_framer_fn(rb_scan_until_mem_iov, chunks[i], rounds, &frames[0]);
+		double full = bench_framer_fn(until_full, chunks[i], rounds, &frames[1]);
+
+		check(frames[0] == frames[1], "bench_framer frames", i);
+		fprintf(stderr, "framing traces by %zu byte reads: %.0f ns, searching from start %.0f ns\n", chunks[i], scan, full);
+	}
+}
+
 #/* */
 int main()
 {
 	test_suite1();
+	test_suite2();
+	test_suite3();
+	test_suite4();
+	bench_framer();
+
+	fprintf(stderr, "done %d tests: %d OK %d FAILS\n", ok + faults, ok, faults);
+
+	if (faults) {
+		return 1;
+	}
 	return 0;
 }
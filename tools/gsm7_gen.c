@@ -0,0 +1,266 @@
+/*
+ * Generate gsm7_luts.h from tools/gsm7_luts.spec
+ *
+ * Forward tables are written as LUT_GSM7_LS16[table][septet] and
+ * LUT_GSM7_SS16[table][septet].  The reverse table covers all code points
+ * reachable from any table in blocks of GSM7_REV_BLOCK characters, each entry
+ * holds the locking and single shift tables the character is in and its
+ * septets there, so encoding takes one load per character.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define TABLES		14
+#define SEPTETS		128
+#define BLOCK		64
+#define ESC		0x1b
+
+static uint16_t ls16[TABLES][SEPTETS];
+static uint16_t ss16[TABLES][SEPTETS];
+static int ls_alias[TABLES];
+static unsigned seen_ls, seen_ss;
+
+/* septet of character in table, kind 0 locking 1 single shift */
+struct multi {
+	uint16_t	ch;
+	uint8_t		table;
+	uint8_t		septet;
+};
+
+static uint64_t rev[0x10000];
+static struct multi multi[2 * TABLES * SEPTETS];
+static unsigned multi_count;
+
+#/* */
+static void die(unsigned lno, const char * msg)
+{
+	fprintf(stderr, "gsm7_gen: line %u: %s\n", lno, msg);
+	exit(1);
+}
+
+#/* */
+static void parse(FILE * in)
+{
+	char line[512];
+	uint16_t * table = NULL;
+	unsigned lno = 0, pos = 0;
+
+	while (fgets(line, sizeof(line), in)) {
+		char * tok, * save;
+		unsigned n;
+		int alias;
+		char kind[16];
+
+		++lno;
+		if (line[0] == '#') {
+			continue;
+		}
+		if (sscanf(line, "%15s %u", kind, &n) == 2 && (!strcmp(kind, "locking") || !strcmp(kind, "shift"))) {
+			if (table && pos != SEPTETS) {
+				die(lno, "previous table is not 128 septets");
+			}
+			if (n >= TABLES) {
+				die(lno, "bad table number");
+			}
+			pos = 0;
+			if (kind[0] == 'l') {
+				seen_ls |= 1 << n;
+				table = ls16[n];
+				ls_alias[n] = -1;
+				if (sscanf(line, "%*s %*u %*s = %d", &alias) == 1) {
+					if (alias < 0 || alias >= TABLES || alias == (int) n) {
+						die(lno, "bad alias");
+					}
+					ls_alias[n] = alias;
+					table = NULL;
+				}
+			} else {
+				seen_ss |= 1 << n;
+				table = ss16[n];
+			}
+			continue;
+		}
+
+		for (tok = strtok_r(line, " \t\r\n", &save); tok; tok = strtok_r(NULL, " \t\r\n", &save)) {
+			unsigned long first, last, count = 1;
+			char * end;
+
+			if (!table) {
+				die(lno, "data outside of table");
+			}
+			first = last = strtoul(tok, &end, 16);
+			if (*end == '-') {
+				last = strtoul(end + 1, &end, 16);
+			} else if (*end == '*') {
+				count = strtoul(end + 1, &end, 10);
+			}
+			if (*end || first > 0xffff || last > 0xffff || last < first) {
+				die(lno, "bad code point");
+			}
+			for (; first <= last; ++first) {
+				for (unsigned long k = 0; k < count; ++k) {
+					if (pos >= SEPTETS) {
+						die(lno, "table is longer than 128 septets");
+					}
+					table[pos++] = first;
+				}
+			}
+		}
+	}
+	if (table && pos != SEPTETS) {
+		die(lno, "last table is not 128 septets");
+	}
+	if (seen_ls != (1 << TABLES) - 1 || seen_ss != (1 << TABLES) - 1) {
+		die(lno, "missing tables");
+	}
+	for (unsigned t = 0; t < TABLES; ++t) {
+		if (ls_alias[t] >= 0) {
+			if (ls_alias[ls_alias[t]] >= 0) {
+				die(lno, "alias of alias");
+			}
+			memcpy(ls16[t], ls16[ls_alias[t]], sizeof(ls16[t]));
+		}
+	}
+}
+
+/*
+ * entry layout, see the GSM7_REV_* macros written below
+ *  0-13  locking tables with the character
+ * 14-27  single shift tables with the character
+ * 28-34  septet in the first locking table
+ * 35-41  septet in the first single shift table
+ * 42     septet differs in another table, see GSM7_REV_MULTI
+ */
+#/* */
+static void add(uint16_t ch, unsigned table, unsigned kind, unsigned septet)
+{
+	uint64_t e = rev[ch];
+	unsigned shift = kind ? 14 : 0;
+	unsigned sshift = kind ? 35 : 28;
+
+	/* unused positions hold zero or the first code point of the block */
+	if ((ch & 0xff) == 0 || ch == ESC) {
+		return;
+	}
+	/* lowest septet of the table wins */
+	if (e & (1ull << (shift + table))) {
+		return;
+	}
+	if (!(e & (0x3fffull << shift))) {
+		e |= (uint64_t) septet << sshift;
+	} else if (((e >> sshift) & 0x7f) != septet) {
+		e |= 1ull << 42;
+		multi[multi_count].ch = ch;
+		multi[multi_count].table = table | (kind ? 0x80 : 0);
+		multi[multi_count].septet = septet;
+		++multi_count;
+	}
+	rev[ch] = e | (1ull << (shift + table));
+}
+
+#/* */
+static void print_lut(const char * name, uint16_t lut[TABLES][SEPTETS])
+{
+	printf("static const uint16_t %s[%u][%u] = {\n", name, TABLES, SEPTETS);
+	for (unsigned t = 0; t < TABLES; ++t) {
+		printf("\t{");
+		for (unsigned i = 0; i < SEPTETS; ++i) {
+			printf("%s0x%x,", i % 16 ? " " : "\n\t\t", lut[t][i]);
+		}
+		printf("\n\t},\n");
+	}
+	printf("};\n\n");
+}
+
+#/* */
+int main(int argc, char * argv[])
+{
+	FILE * in = stdin;
+	unsigned locking = 0, blocks = 1, t, i;
+	static uint8_t index[0x10000 / BLOCK];
+
+	if (argc > 1 && !(in = fopen(argv[1], "r"))) {
+		perror(argv[1]);
+		return 1;
+	}
+	parse(in);
+
+	for (t = 0; t < TABLES; ++t) {
+		if (ls_alias[t] < 0) {
+			locking |= 1 << t;
+			for (i = 0; i < SEPTETS; ++i) {
+				add(ls16[t][i], t, 0, i);
+			}
+		}
+	}
+	for (t = 0; t < TABLES; ++t) {
+		for (i = 0; i < SEPTETS; ++i) {
+			add(ss16[t][i], t, 1, i);
+		}
+	}
+
+	/* block 0 stays empty for unreachable code points */
+	for (i = 0; i < 0x10000 / BLOCK; ++i) {
+		for (unsigned k = 0; k < BLOCK; ++k) {
+			if (rev[i * BLOCK + k]) {
+				index[i] = blocks++;
+				break;
+			}
+		}
+	}
+	if (blocks > 256) {
+		fprintf(stderr, "gsm7_gen: too many blocks\n");
+		return 1;
+	}
+
+	printf("/* generated by tools/gsm7_gen from tools/gsm7_luts.spec, do not edit */\n");
+	printf("#ifndef CHAN_QUECTEL_GSM7_LUTS_H_INCLUDED\n");
+	printf("#define CHAN_QUECTEL_GSM7_LUTS_H_INCLUDED\n\n");
+
+	printf("/* GSM 03.38 7bit alphabet */\n");
+	print_lut("LUT_GSM7_LS16", ls16);
+	print_lut("LUT_GSM7_SS16", ss16);
+
+	printf("/* tables usable for encoding with locking shift */\n");
+	printf("#define GSM7_LOCKING_TABLES\t0x%04x\n\n", locking);
+
+	printf("/* reverse lookup entry of a code point, GSM7_REV_ENTRY(ch) */\n");
+	printf("#define GSM7_REV_BLOCK\t\t%u\n", BLOCK);
+	printf("#define GSM7_REV_ENTRY(ch)\t(GSM7_REV[GSM7_REV_INDEX[(ch) / GSM7_REV_BLOCK]][(ch) %% GSM7_REV_BLOCK])\n");
+	printf("#define GSM7_REV_LOCKING(e)\t((unsigned) (e) & 0x3fff)\n");
+	printf("#define GSM7_REV_SHIFT(e)\t((unsigned) ((e) >> 14) & 0x3fff)\n");
+	printf("#define GSM7_REV_LS_SEPTET(e)\t((unsigned) ((e) >> 28) & 0x7f)\n");
+	printf("#define GSM7_REV_SS_SEPTET(e)\t((unsigned) ((e) >> 35) & 0x7f)\n");
+	printf("#define GSM7_REV_IS_MULTI(e)\t((e) >> 42 & 1)\n\n");
+
+	printf("static const uint8_t GSM7_REV_INDEX[%u] = {", 0x10000 / BLOCK);
+	for (i = 0; i < 0x10000 / BLOCK; ++i) {
+		printf("%s%u,", i % 32 ? " " : "\n\t", index[i]);
+	}
+	printf("\n};\n\n");
+
+	printf("static const uint64_t GSM7_REV[%u][GSM7_REV_BLOCK] = {\n\t{ 0 },\n", blocks);
+	for (i = 0; i < 0x10000 / BLOCK; ++i) {
+		if (!index[i]) {
+			continue;
+		}
+		printf("\t{ /* %04x */", i * BLOCK);
+		for (unsigned k = 0; k < BLOCK; ++k) {
+			printf("%s0x%llx,", k % 8 ? " " : "\n\t\t", (unsigned long long) rev[i * BLOCK + k]);
+		}
+		printf("\n\t},\n");
+	}
+	printf("};\n\n");
+
+	printf("/* septets of characters differing from the entry, table | 0x80 for single shift */\n");
+	printf("static const struct { uint16_t ch; uint8_t table; uint8_t septet; } GSM7_REV_MULTI[%u] = {\n", multi_count);
+	for (i = 0; i < multi_count; ++i) {
+		printf("\t{ 0x%04x, 0x%02x, %u },\n", multi[i].ch, multi[i].table, multi[i].septet);
+	}
+	printf("};\n\n");
+
+	printf("#endif /* CHAN_QUECTEL_GSM7_LUTS_H_INCLUDED */\n");
+	return 0;
+}
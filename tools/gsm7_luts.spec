@@ -0,0 +1,150 @@
+# GSM 03.38 default alphabet and 3GPP TS 23.038 national language tables
+#
+# "locking N name" or "shift N name" starts table N, followed by the UCS-2
+# code points of septets 0-127 in hex: "x" one code point, "x-y" a run of
+# consecutive code points, "x*n" x repeated n times.  Positions holding 0,
+# 1b (escape) or a code point with zero low byte are unused and are not
+# encoded to.  "locking N name = M" decodes as table M and is never used
+# for encoding, for languages without a locking shift table.
+#
+# tools/gsm7_gen turns this into gsm7_luts.h.
+
+locking 0 default
+	40 a3 24 a5 e8-e9 f9 ec f2 c7 a d8 f8 d c5 e5 394 5f 3a6 393 39b 3a9
+	3a0 3a8 3a3 398 39e 1b c6 e6 df c9 20-23 a4 25-3f a1 41-5a c4 d6 d1 dc
+	a7 bf 61-7a e4 f6 f1 fc e0
+
+shift 0 default
+	600*10 c 0*9 5e 0*19 7b 7d 0*5 5c 0*12 5b 7e 5d 0 7c 0*36 20ac 2000*26
+
+locking 1 turkish
+	40 a3 24 a5 20ac e9 f9 131 f2 c7 a 11e-11f d c5 e5 394 5f 3a6 393 39b
+	3a9 3a0 3a8 3a3 398 39e 1b 15e-15f df c9 20-23 a4 25-3f 130 41-5a c4
+	d6 d1 dc a7 e7 61-7a e4 f6 f1 fc e0
+
+shift 1 turkish
+	2000*10 c 0*9 5e 0*19 7b 7d 0*5 5c 0*12 5b 7e 5d 0 7c 0*6 11e 100 130
+	100*9 15e 100*15 e7 0 20ac 2000 11f 100 131 100*9 15f 100*12
+
+locking 2 spanish = 0
+
+shift 2 spanish
+	100*9 e7 c 0*9 5e 0*19 7b 7d 0*5 5c 0*12 5b 7e 5d 0 7c c1 0*7 cd 0*5
+	d3 0*5 da 0*11 e1 0*3 20ac 2000*3 ed 0*5 f3 0*5 fa 0*10
+
+locking 3 portuguese
+	40 a3 24 a5 ea e9 fa ed f3 e7 a d4 f4 d c1 e1 394 5f aa c7 c0 221e 5e
+	5c 20ac d3 7c 1b c2 e2 ca c9 20-23 ba 25-3f cd 41-5a c3 d5 da dc a7 7e
+	61-7a e3 f5 60 fc e0
+
+shift 3 portuguese
+	0*5 ea 0*3 e7 c d4 f4 0 c1 e1 0*2 3a6 393 5e 3a9 3a0 3a8 3a3 398 300*5
+	ca 0*8 7b 7d 0*5 5c 0*12 5b 7e 5d 0 7c c0 0*7 cd 0*5 d3 0*5 da 0*5 c3
+	d5 0*4 c2 0*3 20ac 2000*3 ed 0*5 f3 0*5 fa 0*5 e3 f5 0*2 e2
+
+locking 4 bengali
+	981-983 985-98b a 98c 900 d 0 98f-990 900*2 993-99a 1b 99b-99e 20-21
+	99f-9a4 29 28 9a5-9a6 2c 9a7 2e 9a8 30-3b 0 9aa-9ab 3f 9ac-9b0 900 9b2
+	900*3 9b6-9b9 9bc-9c4 900*2 9c7-9c8 900*2 9cb-9ce 61-7a 9d7 9dc-9dd
+	9f0-9f1
+
+shift 4 bengali
+	40 a3 24 a5 bf 22 a4 25-27 c 2a-2b 0 2d 2f 3c-3e a1 5e a1 5f 23 2a
+	9e6-9e7 900 9e8-9ef 9df-9e2 7b 7d 9e3 9f2-9f5 5c 9f6-9fa 900*7 5b 7e
+	5d 0 7c 41-5a 0*10 20ac 2000*26
+
+locking 5 gujarati
+	a81-a83 a85-a8b a a8c-a8d d 0 a8f-a91 a00 a93-a9a 1b a9b-a9e 20-21
+	a9f-aa4 29 28 aa5-aa6 2c aa7 2e aa8 30-3b 0 aaa-aab 3f aac-ab0 a00
+	ab2-ab3 a00 ab5-ab9 abc-ac5 a00 ac7-ac9 a00 acb-acd ad0 61-7a ae0-ae3
+	af1
+
+shift 5 gujarati
+	40 a3 24 a5 bf 22 a4 25-27 c 2a-2b 0 2d 2f 3c-3e a1 5e a1 5f 23 2a
+	964-965 900 ae6-aef a00*2 7b 7d 0*5 5c 0*12 5b 7e 5d 0 7c 41-5a 0*10
+	20ac 2000*26
+
+locking 6 hindi
+	901-903 905-90b a 90c-90d d 90e-91a 1b 91b-91e 20-21 91f-924 29 28
+	925-926 2c 927 2e 928 30-3b 929-92b 3f 92c-939 93c-94d 950 61-7a 972
+	97b-97c 97e-97f
+
+shift 6 hindi
+	40 a3 24 a5 bf 22 a4 25-27 c 2a-2b 0 2d 2f 3c-3e a1 5e a1 5f 23 2a
+	964-965 900 966-96f 951-952 7b 7d 953-954 958-95a 5c 95b-963 970-971
+	900 5b 7e 5d 0 7c 41-5a 0*10 20ac 2000*26
+
+locking 7 kannada
+	900 c82-c83 c85-c8b a c8c c00 d c8e-c90 c00 c92-c9a 1b c9b-c9e 20-21
+	c9f-ca4 29 28 ca5-ca6 2c ca7 2e ca8 30-3b 0 caa-cab 3f cac-cb3 c00
+	cb5-cb9 cbc-cc4 c00 cc6-cc8 c00 cca-ccd cd5 61-7a cd6 ce0-ce3
+
+shift 7 kannada
+	40 a3 24 a5 bf 22 a4 25-27 c 2a-2b 0 2d 2f 3c-3e a1 5e a1 5f 23 2a
+	964-965 900 ce6-cef cde cf1 7b 7d cf2 c00*4 5c 0*12 5b 7e 5d 0 7c
+	41-5a 0*10 20ac 2000*26
+
+locking 8 malayalam
+	c00 d02-d03 d05-d0b a d0c d00 d d0e-d10 d00 d12-d1a 1b d1b-d1e 20-21
+	d1f-d24 29 28 d25-d26 2c d27 2e d28 30-3b 0 d2a-d2b 3f d2c-d39 d00
+	d3d-d44 d00 d46-d48 d00 d4a-d4d d57 61-7a d60-d63 d79
+
+shift 8 malayalam
+	40 a3 24 a5 bf 22 a4 25-27 c 2a-2b 0 2d 2f 3c-3e a1 5e a1 5f 23 2a
+	964-965 900 d66-d71 7b 7d d72-d75 d7a 5c d7b-d7f d00*7 5b 7e 5d 0 7c
+	41-5a 0*10 20ac 2000*26
+
+locking 9 oriya
+	b01-b03 b05-b0b a b0c b00 d 0 b0f-b10 b00*2 b13-b1a 1b b1b-b1e 20-21
+	b1f-b24 29 28 b25-b26 2c b27 2e b28 30-3b 0 b2a-b2b 3f b2c-b30 b00
+	b32-b33 b00 b35-b39 b3c-b44 b00*2 b47-b48 b00*2 b4b-b4d b56 61-7a b57
+	b60-b63
+
+shift 9 oriya
+	40 a3 24 a5 bf 22 a4 25-27 c 2a-2b 0 2d 2f 3c-3e a1 5e a1 5f 23 2a
+	964-965 900 b66-b6f b5c-b5d 7b 7d b5f b70-b71 b00*2 5c 0*12 5b 7e 5d 0
+	7c 41-5a 0*10 20ac 2000*26
+
+locking 10 punjabi
+	a01-a03 a05-a0a a00 a 0*2 d 0 a0f-a10 a00*2 a13-a1a 1b a1b-a1e 20-21
+	a1f-a24 29 28 a25-a26 2c a27 2e a28 30-3b 0 a2a-a2b 3f a2c-a30 a00
+	a32-a33 a00 a35-a36 a00 a38-a39 a3c a00 a3e-a42 a00*4 a47-a48 a00*2
+	a4b-a4d a51 61-7a a70-a74
+
+shift 10 punjabi
+	40 a3 24 a5 bf 22 a4 25-27 c 2a-2b 0 2d 2f 3c-3e a1 5e a1 5f 23 2a
+	964-965 900 a66-a6f a59-a5a 7b 7d a5b-a5c a5e a75 a00 5c 0*12 5b 7e 5d
+	0 7c 41-5a 0*10 20ac 2000*26
+
+locking 11 tamil
+	a00 b82-b83 b85-b8a b00 a 0*2 d b8e-b90 b00 b92-b95 b00*3 b99-b9a 1b 0
+	b9c b00 b9e 20-21 b9f b00*3 ba3-ba4 29 28 0*2 2c 0 2e ba8 30-3b
+	ba9-baa b00 3f 0*2 bae-bb9 b00*2 bbe-bc2 b00*3 bc6-bc8 b00 bca-bcd bd0
+	61-7a bd7 bf0-bf2 bf9
+
+shift 11 tamil
+	40 a3 24 a5 bf 22 a4 25-27 c 2a-2b 0 2d 2f 3c-3e a1 5e a1 5f 23 2a
+	964-965 900 be6-bef bf3-bf4 7b 7d bf5-bf8 bfa 5c 0*12 5b 7e 5d 0 7c
+	41-5a 0*10 20ac 2000*26
+
+locking 12 telugu
+	c01-c03 c05-c0b a c0c c00 d c0e-c10 c00 c12-c1a 1b c1b-c1e 20-21
+	c1f-c24 29 28 c25-c26 2c c27 2e c28 30-3b 0 c2a-c2b 3f c2c-c33 c00
+	c35-c39 c00 c3d-c44 c00 c46-c48 c00 c4a-c4d c55 61-7a c56 c60-c63
+
+shift 12 telugu
+	40 a3 24 a5 bf 22 a4 25-27 c 2a-2b 0 2d 2f 3c-3e a1 5e a1 5f 23 2a 0*3
+	c66-c6f c58-c59 7b 7d c78-c7c 5c c7d-c7f c00*9 5b 7e 5d 0 7c 41-5a
+	0*10 20ac 2000*26
+
+locking 13 urdu
+	627 622 628 67b 680 67e 6a6 62a 6c2 67f a 679 67d d 67a 67c 62b-62c
+	681 684 683 685-687 62d-62f 1b 68c 688-68a 20-21 68f 68d 630-631 691
+	693 29 28 699 632 2c 696 2e 698 30-3b 69a 633-634 3f 635-639 641-642
+	6a9-6ab 6af 6b3 6b1 644-646 6ba-6bc 648 6c4 6d5 6c1 6be 621 6cc 6d0
+	6d2 64d 650 64f 657 654 61-7a 655 651 653 656 670
+
+shift 13 urdu
+	40 a3 24 a5 bf 22 a4 25-27 c 2a-2b 0 2d 2f 3c-3e a1 5e a1 5f 23 2a
+	600-601 600 6f0-6f9 60c-60d 7b 7d 60e-612 5c 613-614 61b 61f 640 652
+	658 66b-66c 672-673 6cd 5b 7e 5d 6d4 7c 41-5a 0*10 20ac 2000*26